@@ -0,0 +1,144 @@
+"""Fixtures shared by the benchmark suite.
+
+With ``pytest-benchmark`` installed its ``benchmark`` fixture is used as
+is. Without it, a small stand-in with the same calling convention times
+each benchmark with ``time.perf_counter``, so the suite also runs offline
+on a bare environment.
+"""
+
+import json
+import platform
+import statistics
+import time
+
+import pytest
+
+try:
+    import pytest_benchmark  # noqa: F401
+
+    HAVE_PYTEST_BENCHMARK = True
+except ImportError:
+    HAVE_PYTEST_BENCHMARK = False
+
+
+class Counted:
+    """Wrap a callable and count its evaluations.
+
+    Parameters
+    ----------
+    func : Callable
+        Function being counted.
+    """
+
+    def __init__(self, func):
+        self.func = func
+        self.calls = 0
+
+    def __call__(self, *args):
+        self.calls += 1
+        return self.func(*args)
+
+
+@pytest.fixture
+def counted():
+    """Return the ``Counted`` wrapper class."""
+    return Counted
+
+
+if not HAVE_PYTEST_BENCHMARK:
+    _RESULTS = []
+
+    class SimpleBenchmark:
+        """Stand-in for the ``pytest-benchmark`` fixture.
+
+        Parameters
+        ----------
+        name : str
+            Test node name.
+        group : str or None
+            Benchmark group from ``@pytest.mark.benchmark(group=...)``.
+        min_rounds : int
+            Number of timed rounds.
+        """
+
+        def __init__(self, name, group, min_rounds):
+            self.name = name
+            self.group = group
+            self.min_rounds = min_rounds
+            self.extra_info = {}
+            self.stats = None
+
+        def __call__(self, func, *args, **kwargs):
+            result = func(*args, **kwargs)
+            times = []
+            for _ in range(self.min_rounds):
+                start = time.perf_counter()
+                func(*args, **kwargs)
+                times.append(time.perf_counter() - start)
+            self.stats = {
+                "min": min(times),
+                "median": statistics.median(times),
+                "mean": statistics.fmean(times),
+                "rounds": len(times),
+            }
+            _RESULTS.append(
+                {
+                    "name": self.name,
+                    "group": self.group,
+                    "stats": self.stats,
+                    "extra_info": self.extra_info,
+                }
+            )
+            return result
+
+    def pytest_addoption(parser):
+        group = parser.getgroup("benchmark")
+        group.addoption(
+            "--benchmark-min-rounds",
+            type=int,
+            default=20,
+            help="Timed rounds per benchmark.",
+        )
+        group.addoption(
+            "--benchmark-json",
+            default=None,
+            help="Write the results to this JSON file.",
+        )
+
+    def pytest_configure(config):
+        config.addinivalue_line(
+            "markers", "benchmark(group): group benchmarks in the summary"
+        )
+
+    @pytest.fixture
+    def benchmark(request):
+        """Time a callable as ``pytest-benchmark`` would."""
+        marker = request.node.get_closest_marker("benchmark")
+        group = marker.kwargs.get("group") if marker else None
+        rounds = request.config.getoption("--benchmark-min-rounds")
+        return SimpleBenchmark(request.node.name, group, rounds)
+
+    def pytest_terminal_summary(terminalreporter, config):
+        if not _RESULTS:
+            return
+        terminalreporter.section("benchmark (perf_counter)")
+        for result in sorted(_RESULTS, key=lambda r: (r["group"] or "")):
+            evaluations = result["extra_info"].get("evaluations", "-")
+            terminalreporter.write_line(
+                f"{result['group'] or '':<16} {result['name']:<48} "
+                f"median {result['stats']['median'] * 1e6:10.2f} us  "
+                f"evaluations {evaluations}"
+            )
+        path = config.getoption("--benchmark-json")
+        if path:
+            machine = {
+                "python": platform.python_version(),
+                "machine": platform.machine(),
+                "system": platform.system(),
+            }
+            with open(path, "w") as handle:
+                json.dump(
+                    {"machine_info": machine, "benchmarks": _RESULTS},
+                    handle,
+                    indent=2,
+                )
@@ -0,0 +1,202 @@
+"""Compare ``numeric.root_approximation`` with ``scipy.optimize``.
+
+Each benchmark records its wall time through the ``benchmark`` fixture and
+the number of function evaluations in ``benchmark.extra_info``. Python
+benchmarks count calls of the callable in a separate run. Native benchmarks
+run a ``CompiledExpression`` entirely in C++ through the ``SolveOptions``
+overloads and record ``SolveResult.evaluations`` from the timed call.
+
+Derivatives differ within the "newton" group: ``newton_method`` on a Python
+callable approximates f' with centered finite differences (two extra calls
+per iteration), the native run uses the derivative tape and scipy is given
+the analytic ``fprime``. Only evaluations of f are counted, and
+``extra_info["derivative"]`` names the source of f'.
+
+Run with ``pytest benchmarks``; add ``--benchmark-json=results.json`` to
+keep the numbers.
+"""
+
+import numeric
+import numpy as np
+import pytest
+
+optimize = pytest.importorskip("scipy.optimize")
+ra = numeric.root_approximation
+
+# Example 1 of Section 2.1 in "Numerical Analysis": x^3 + 4x^2 - 10 = 0.
+ROOT = 1.365230013414097
+SOURCE = "x^3 + 4*x^2 - 10"
+TOL = 1e-8
+BATCH = 10000
+OPTIONS = ra.SolveOptions(max_iters=100, tol=TOL)
+
+
+def f(x):
+    return x**3 + 4.0 * x**2 - 10.0
+
+
+def df(x):
+    return 3.0 * x**2 + 8.0 * x
+
+
+def count_evaluations(counted, method, *args):
+    """Run method on a counted copy of f and return the number of calls."""
+    func = counted(f)
+    method(func, *args)
+    return func.calls
+
+
+def check(benchmark, root, evaluations):
+    """Check the root and record the evaluation count."""
+    assert abs(root - ROOT) < 1e-6
+    benchmark.extra_info["evaluations"] = evaluations
+
+
+def check_result(benchmark, result):
+    """Check a SolveResult and record its evaluation count."""
+    assert result.status == ra.SolveStatus.CONVERGED
+    check(benchmark, result.root, result.evaluations)
+
+
+@pytest.mark.benchmark(group="bisect")
+def test_bisection_python(benchmark, counted):
+    root = benchmark(ra.bisection, f, 1.0, 2.0, 100, TOL)
+    args = (1.0, 2.0, 100, TOL)
+    check(benchmark, root, count_evaluations(counted, ra.bisection, *args))
+
+
+@pytest.mark.benchmark(group="bisect")
+def test_bisection_native(benchmark):
+    compiled = ra.CompiledExpression(SOURCE)
+    result = benchmark(ra.bisection, compiled, 1.0, 2.0, OPTIONS)
+    check_result(benchmark, result)
+
+
+@pytest.mark.benchmark(group="bisect")
+def test_bisection_scipy(benchmark):
+    root, info = benchmark(
+        optimize.bisect, f, 1.0, 2.0, xtol=TOL, full_output=True
+    )
+    check(benchmark, root, info.function_calls)
+
+
+@pytest.mark.benchmark(group="newton")
+def test_newton_python(benchmark, counted):
+    root = benchmark(ra.newton_method, f, 1.5, 100, TOL)
+    args = (1.5, 100, TOL)
+    benchmark.extra_info["derivative"] = "finite difference"
+    check(benchmark, root, count_evaluations(counted, ra.newton_method, *args))
+
+
+@pytest.mark.benchmark(group="newton")
+def test_newton_native(benchmark):
+    compiled = ra.CompiledExpression(SOURCE)
+    result = benchmark(ra.newton_method, compiled, 1.5, OPTIONS)
+    benchmark.extra_info["derivative"] = "derivative tape"
+    check_result(benchmark, result)
+
+
+@pytest.mark.benchmark(group="newton")
+def test_newton_scipy(benchmark):
+    root, info = benchmark(
+        optimize.newton, f, 1.5, fprime=df, tol=TOL, full_output=True
+    )
+    benchmark.extra_info["derivative"] = "analytic"
+    check(benchmark, root, info.function_calls)
+
+
+@pytest.mark.benchmark(group="secant")
+def test_secant_python(benchmark, counted):
+    root = benchmark(ra.secant_method, f, 1.0, 2.0, 100, TOL)
+    args = (1.0, 2.0, 100, TOL)
+    check(benchmark, root, count_evaluations(counted, ra.secant_method, *args))
+
+
+@pytest.mark.benchmark(group="secant")
+def test_secant_native(benchmark):
+    compiled = ra.CompiledExpression(SOURCE)
+    result = benchmark(ra.secant_method, compiled, 1.0, 2.0, OPTIONS)
+    check_result(benchmark, result)
+
+
+@pytest.mark.benchmark(group="secant")
+def test_secant_scipy(benchmark):
+    root, info = benchmark(
+        optimize.newton, f, 1.0, x1=2.0, tol=TOL, full_output=True
+    )
+    check(benchmark, root, info.function_calls)
+
+
+@pytest.mark.benchmark(group="bracketing")
+def test_false_position_python(benchmark, counted):
+    root = benchmark(ra.false_position, f, 1.0, 2.0, 100, TOL)
+    args = (1.0, 2.0, 100, TOL)
+    evaluations = count_evaluations(counted, ra.false_position, *args)
+    check(benchmark, root, evaluations)
+
+
+@pytest.mark.benchmark(group="bracketing")
+def test_brentq_scipy(benchmark):
+    root, info = benchmark(
+        optimize.brentq, f, 1.0, 2.0, xtol=TOL, full_output=True
+    )
+    check(benchmark, root, info.function_calls)
+
+
+def batch_problems():
+    """Return BATCH problems x^3 - c = 0 with their initial guesses."""
+    c = np.linspace(1.0, 1000.0, BATCH)
+    return c, np.full(BATCH, 1.0)
+
+
+def check_batch(benchmark, roots, c, evaluations):
+    """Check batched roots and record the evaluation count."""
+    assert np.allclose(roots, np.cbrt(c), atol=1e-6)
+    benchmark.extra_info["problems"] = BATCH
+    benchmark.extra_info["evaluations"] = evaluations
+
+
+@pytest.mark.benchmark(group="batch")
+def test_newton_batch_native(benchmark):
+    c, x0 = batch_problems()
+    compiled = ra.CompiledExpression("x^3 - p0")
+    params = [[value] for value in c]
+    x0 = list(x0)
+    results = benchmark(
+        ra.newton_method_batch, compiled, x0, params, OPTIONS
+    )
+    assert all(r.status == ra.SolveStatus.CONVERGED for r in results)
+    roots = np.array([r.root for r in results])
+    evaluations = sum(r.evaluations for r in results)
+    check_batch(benchmark, roots, c, evaluations)
+
+
+@pytest.mark.benchmark(group="batch")
+def test_newton_lanes_native(benchmark):
+    c, x0 = batch_problems()
+    compiled = ra.CompiledExpression("x^3 - p0")
+    params = [[value] for value in c]
+    x0 = list(x0)
+    result = benchmark(ra.newton_method_lanes, compiled, x0, params)
+    benchmark.extra_info["utilization"] = result.utilization
+    check_batch(
+        benchmark, np.asarray(result.roots), c, result.lane_evaluations
+    )
+
+
+@pytest.mark.benchmark(group="batch")
+def test_newton_batch_scipy(benchmark, counted):
+    c, x0 = batch_problems()
+
+    def cubic(x, c):
+        return x**3 - c
+
+    def dcubic(x, c):
+        return 3.0 * x**2
+
+    roots = benchmark(
+        optimize.newton, cubic, x0, fprime=dcubic, args=(c,), tol=TOL
+    )
+    func = counted(cubic)
+    optimize.newton(func, x0, fprime=dcubic, args=(c,), tol=TOL)
+    check_batch(benchmark, roots, c, func.calls * BATCH)
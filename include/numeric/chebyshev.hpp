@@ -0,0 +1,86 @@
+#pragma once
+#include <functional>
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Chebyshev series p(x) = sum_k c_k T_k(t) on [a, b], where
+ * t = (2x - a - b) / (b - a).
+ */
+struct ChebyshevSeries {
+    double a = -1.0;
+    double b = 1.0;
+    std::vector<double> coefs;
+    bool resolved = false;
+
+    /**
+     * @brief Evaluate the series and its derivative at x.
+     *
+     * @param x Point in [a, b].
+     * @return Tuple of p(x) and p'(x).
+     */
+    std::tuple<double, double> evaluate(double x) const;
+};
+
+/**
+ * @brief Chebyshev points of the second kind x_j = cos(j pi / n), j = 0..n,
+ * mapped to [a, b].
+ *
+ * @param n Degree; n + 1 points are returned.
+ * @param a Left endpoint of the interval.
+ * @param b Right endpoint of the interval.
+ * @return Points ordered from b down to a.
+ */
+std::vector<double> chebyshev_points(int n, double a, double b);
+
+/**
+ * @brief Coefficients of the degree n polynomial interpolating values at the
+ * n + 1 Chebyshev points of the second kind. Uses an FFT-based DCT-I when n
+ * is a power of two and a direct O(n^2) sum otherwise.
+ *
+ * @param values Function values at chebyshev_points(n, a, b).
+ * @return Coefficients c_0..c_n.
+ */
+std::vector<double> chebyshev_coefficients(const std::vector<double>& values);
+
+/**
+ * @brief Evaluate a Chebyshev series and its derivative at t in [-1, 1] with
+ * Clenshaw's recurrence, the Chebyshev analogue of Horner's method.
+ *
+ * @param n The degree of the series.
+ * @param coefs List of length n+1 of Chebyshev coefficients c_0..c_n.
+ * @param x0 Value that is being evaluated.
+ * @return Tuple of the series and derivative at x0.
+ */
+std::tuple<double, double> clenshaw(int n, const double coefs[], double x0);
+
+/**
+ * @brief Adaptively interpolate f on [a, b] at 17, 33, 65, ... Chebyshev
+ * points, reusing every previous sample, until the trailing coefficients fall
+ * below TOL relative to the largest coefficient. Negligible trailing
+ * coefficients are then chopped.
+ *
+ * @param func Continuous function f(x).
+ * @param a Left endpoint of the interval.
+ * @param b Right endpoint of the interval.
+ * @param MAX_DEGREE Largest degree attempted.
+ * @param TOL Relative coefficient tolerance.
+ * @return Series; resolved is false when MAX_DEGREE was insufficient.
+ */
+ChebyshevSeries chebyshev_fit(
+    const std::function<double(double)>& func,
+    double a,
+    double b,
+    int MAX_DEGREE,
+    double TOL
+);
+
+/**
+ * @brief Real roots of a Chebyshev series on its interval, computed as
+ * eigenvalues of the colleague matrix and polished with Newton steps on the
+ * series.
+ *
+ * @param series Chebyshev series.
+ * @return Sorted roots in [series.a, series.b].
+ */
+std::vector<double> chebyshev_series_roots(const ChebyshevSeries& series);
@@ -0,0 +1,211 @@
+#pragma once
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "numeric/solve_options.hpp"
+
+/**
+ * @brief Operation performed by one bytecode instruction.
+ */
+enum class Opcode : unsigned char {
+    CONSTANT,
+    VARIABLE,
+    PARAMETER,
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    NEGATE,
+    POWER_INT,
+    POWER,
+    EXP,
+    LOG,
+    SQRT,
+    SIN,
+    COS,
+    TAN
+};
+
+/**
+ * @brief Register instruction r[dst] = op(r[lhs], r[rhs]). index holds the
+ * parameter number for PARAMETER and the exponent for POWER_INT; constant
+ * holds the value for CONSTANT.
+ */
+struct Instruction {
+    Opcode op;
+    unsigned char dst;
+    unsigned char lhs;
+    unsigned char rhs;
+    int index;
+    double constant;
+};
+
+/**
+ * @brief Scalar expression f(x; p0, ..., pk) parsed once from a string into
+ * register bytecode.
+ *
+ * The grammar accepts numbers, the variable x, parameters p0, p1, ... with
+ * indices below MAX_PARAMETERS, the constants pi and e, + - * /, ** or ^
+ * (right associative, binding tighter than unary minus), parentheses and the
+ * functions exp, log, sqrt, sin, cos and tan. Parentheses, function calls,
+ * signs and exponents nest at most MAX_DEPTH levels. Constant subexpressions
+ * are folded, and integer exponents up to 64 in magnitude are evaluated by
+ * binary exponentiation. Registers are assigned by expression depth, so a
+ * program uses as few registers as its nesting requires. The derivative tape
+ * replays the same program on dual numbers to produce f and df/dx together.
+ * Evaluation is allocation-free and thread-safe.
+ */
+class CompiledExpression {
+public:
+    /**
+     * @brief Parse and compile an expression.
+     *
+     * @param source Expression text, e.g. "x**3 + 4*x**2 - 10".
+     */
+    explicit CompiledExpression(const std::string& source);
+
+    /**
+     * @brief Evaluate f at x without parameters.
+     *
+     * @param x Point of evaluation.
+     * @return f(x).
+     */
+    double operator()(double x) const;
+
+    /**
+     * @brief Evaluate f at x.
+     *
+     * @param x Point of evaluation.
+     * @param params Parameter values p0, p1, ...; at least parameter_count().
+     * @return f(x; p).
+     */
+    double evaluate(double x, const std::vector<double>& params) const;
+
+    /**
+     * @brief Evaluate f and df/dx at x with the derivative tape.
+     *
+     * @param x Point of evaluation.
+     * @param params Parameter values p0, p1, ...; at least parameter_count().
+     * @return Tuple of f(x; p) and df/dx(x; p).
+     */
+    std::tuple<double, double> evaluate_derivative(double x, const std::vector<double>& params) const;
+
+    /**
+     * @brief Evaluate f on n lanes at once: lane i holds the point x[i] with
+     * parameters params[i]. Each instruction runs over a block of lanes
+     * before the next one starts, so the per-instruction dispatch is paid
+     * once per block rather than once per lane.
+     *
+     * @param x Points of evaluation, one per lane.
+     * @param params Parameter values of each lane; each holds at least
+     * parameter_count() values and may be null when that is zero.
+     * @param f Receives f(x[i]; params[i]).
+     * @param n Number of lanes.
+     */
+    void evaluate_lanes(const double* x, const double* const* params, double* f, int n) const;
+
+    /**
+     * @brief Evaluate f and df/dx on n lanes at once with the derivative
+     * tape, running each instruction over a block of lanes as in
+     * evaluate_lanes.
+     *
+     * @param x Points of evaluation, one per lane.
+     * @param params Parameter values of each lane; each holds at least
+     * parameter_count() values and may be null when that is zero.
+     * @param f Receives f(x[i]; params[i]).
+     * @param df Receives df/dx(x[i]; params[i]).
+     * @param n Number of lanes.
+     */
+    void evaluate_derivative_lanes(const double* x, const double* const* params, double* f, double* df, int n) const;
+
+    /**
+     * @brief Expression text the program was compiled from.
+     *
+     * @return Source string.
+     */
+    const std::string& source() const;
+
+    /**
+     * @brief Number of parameters referenced, one more than the largest index.
+     *
+     * @return Parameter count.
+     */
+    int parameter_count() const;
+
+    /**
+     * @brief Number of registers used by the program.
+     *
+     * @return Register count.
+     */
+    int register_count() const;
+
+    /**
+     * @brief Compiled program.
+     *
+     * @return Instructions in execution order.
+     */
+    const std::vector<Instruction>& instructions() const;
+
+    static constexpr int MAX_REGISTERS = 64;
+    static constexpr int MAX_PARAMETERS = 1024;
+    static constexpr int MAX_DEPTH = 256;
+    static constexpr int LANE_BLOCK = 32;
+
+private:
+    /**
+     * @brief Check that enough parameters were supplied.
+     *
+     * @param params Parameter values.
+     */
+    void check_parameters(const std::vector<double>& params) const;
+
+    std::string source_;
+    std::vector<Instruction> program_;
+    int parameter_count_ = 0;
+    int register_count_ = 0;
+};
+
+/**
+ * @brief Solve f(x; p_k) = 0 for many parameter sets with the Newton-Raphson
+ * method, using the derivative tape for f' and a thread pool across solves.
+ *
+ * @param func Compiled expression f(x; p).
+ * @param x0 Initial approximations, one per solve.
+ * @param params Parameter sets: empty for none, one set shared by every solve,
+ * or one set per solve.
+ * @param MAX_ITERS Maximum number of iterations per solve.
+ * @param TOL Convergence tolerance.
+ * @param num_threads Number of worker threads; values <= 0 use all cores.
+ * @return Approximate roots, one per solve.
+ */
+std::vector<double> newton_method_batch(
+    const CompiledExpression& func,
+    const std::vector<double>& x0,
+    const std::vector<std::vector<double>>& params,
+    int MAX_ITERS,
+    double TOL,
+    int num_threads
+);
+
+/**
+ * @brief Solve f(x; p_k) = 0 for many parameter sets with the Newton-Raphson
+ * method under solve options. The iteration, tolerance and evaluation limits
+ * apply to each solve; the deadline and cancellation token are shared, so
+ * solves not yet finished stop together.
+ *
+ * @param func Compiled expression f(x; p).
+ * @param x0 Initial approximations, one per solve.
+ * @param params Parameter sets: empty for none, one set shared by every solve,
+ * or one set per solve.
+ * @param options Iteration, tolerance and resource limits.
+ * @param num_threads Number of worker threads; values <= 0 use all cores.
+ * @return Solve results, one per solve.
+ */
+std::vector<SolveResult> newton_method_batch(
+    const CompiledExpression& func,
+    const std::vector<double>& x0,
+    const std::vector<std::vector<double>>& params,
+    const SolveOptions& options,
+    int num_threads
+);
@@ -0,0 +1,100 @@
+#pragma once
+#include <complex>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Step size balancing truncation and rounding error for a centered
+ * difference of the given order, h = eps^(1 / (order + 1)) * max(1, |x|).
+ *
+ * @param x Point at which the derivative is evaluated.
+ * @param order Order of accuracy of the difference formula.
+ * @return Step size h.
+ */
+double optimal_step(double x, int order);
+
+/**
+ * @brief Approximate f'(x) using the complex-step formula Im(f(x + ih)) / h.
+ * There is no subtractive cancellation, so h can be tiny and the result is
+ * accurate to machine precision with a single evaluation.
+ *
+ * @param func Analytic function f(z) accepting complex arguments.
+ * @param x Point at which the derivative is evaluated.
+ * @param h Imaginary step size, e.g. 1e-20.
+ * @return Approximate first derivative of f at x.
+ */
+double complex_step_derivative(
+    const std::function<std::complex<double>(std::complex<double>)>& func,
+    double x,
+    double h
+);
+
+/**
+ * @brief Approximate f'(x) using a centered difference stencil. Orders 2 and 4
+ * are the three- and five-point midpoint formulas (Eqs. 4.5 and 4.6) in
+ * "Numerical Analysis"; order 6 uses the seven-point stencil.
+ *
+ * @param func Continuous function f(x).
+ * @param x Point at which the derivative is evaluated.
+ * @param h Step size.
+ * @param order Order of accuracy: 2, 4 or 6.
+ * @return Approximate first derivative of f at x.
+ */
+double centered_difference(
+    const std::function<double(double)>& func,
+    double x,
+    double h,
+    int order
+);
+
+/**
+ * @brief Approximate f'(x) by Richardson extrapolation of centered differences
+ * with steps h, h/2, h/4, ... Section 4.2 in "Numerical Analysis".
+ *
+ * The table is extended until the estimated error drops below TOL or starts
+ * to grow from rounding, and the entry with the smallest estimated error is
+ * returned, so the step size is selected automatically.
+ *
+ * @param func Continuous function f(x).
+ * @param x Point at which the derivative is evaluated.
+ * @param h Initial (largest) step size.
+ * @param MAX_LEVELS Maximum number of rows in the extrapolation table.
+ * @param TOL Target error estimate.
+ * @return Approximate first derivative of f at x.
+ */
+double richardson_derivative(
+    const std::function<double(double)>& func,
+    double x,
+    double h,
+    int MAX_LEVELS,
+    double TOL
+);
+
+/**
+ * @brief Approximate f' at each point of x with a centered difference of the
+ * given order, using optimal_step for every point.
+ *
+ * @param func Continuous function f(x).
+ * @param x Points at which the derivative is evaluated.
+ * @param order Order of accuracy: 2, 4 or 6.
+ * @return Approximate first derivatives, one per point.
+ */
+std::vector<double> centered_difference_batch(
+    const std::function<double(double)>& func,
+    const std::vector<double>& x,
+    int order
+);
+
+/**
+ * @brief Approximate f' at each point of x with the complex-step formula.
+ *
+ * @param func Analytic function f(z) accepting complex arguments.
+ * @param x Points at which the derivative is evaluated.
+ * @param h Imaginary step size, e.g. 1e-20.
+ * @return Approximate first derivatives, one per point.
+ */
+std::vector<double> complex_step_derivative_batch(
+    const std::function<std::complex<double>(std::complex<double>)>& func,
+    const std::vector<double>& x,
+    double h
+);
@@ -0,0 +1,763 @@
+#pragma once
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Expression templates for scalar functions f(x) with compile-time
+ * symbolic differentiation.
+ *
+ * Expressions are built from Variable, numeric constants and the operators and
+ * functions below, e.g. `auto f = pow(x, 3) + 4.0 * pow(x, 2) - 10.0` for
+ * `expression::Variable x`. Each node is a small value type whose structure is
+ * encoded in its C++ type, so f(x) and f.derivative()(x) inline to straight
+ * line code. Expressions are callable on double, Taylor<N> and Interval.
+ */
+namespace expression {
+
+/**
+ * @brief CRTP base identifying expression nodes.
+ *
+ * @tparam E Derived node type.
+ */
+template <class E>
+struct Expression {
+    /**
+     * @brief Downcast to the derived node.
+     *
+     * @return Reference to the derived node.
+     */
+    const E& self() const {
+        return static_cast<const E&>(*this);
+    }
+};
+
+/**
+ * @brief Whether T is an expression node.
+ *
+ * @tparam T Candidate type.
+ */
+template <class T>
+struct is_expression : std::is_base_of<Expression<T>, T> {};
+
+/**
+ * @brief Numeric constant c.
+ */
+struct Constant : Expression<Constant> {
+    double value;
+
+    /**
+     * @brief Construct the constant c.
+     *
+     * @param value Constant value.
+     */
+    explicit Constant(double value) : value(value) {}
+
+    /**
+     * @brief Evaluate the constant.
+     *
+     * @param x Point of evaluation, unused.
+     * @return c converted to the argument type.
+     */
+    template <class T> T operator()(const T& x) const {
+        static_cast<void>(x);
+        return T(value);
+    }
+
+    /**
+     * @brief Derivative of a constant.
+     *
+     * @return Constant zero.
+     */
+    Constant derivative() const {
+        return Constant{0.0};
+    }
+};
+
+/**
+ * @brief Independent variable x.
+ */
+struct Variable : Expression<Variable> {
+    /**
+     * @brief Evaluate the variable.
+     *
+     * @param x Point of evaluation.
+     * @return x.
+     */
+    template <class T> T operator()(const T& x) const {
+        return x;
+    }
+
+    /**
+     * @brief Derivative of x.
+     *
+     * @return Constant one.
+     */
+    Constant derivative() const {
+        return Constant{1.0};
+    }
+};
+
+/**
+ * @brief Pass an expression operand through unchanged.
+ *
+ * @param operand Expression node.
+ * @return The node.
+ */
+template <class E> const E& as_expression(const Expression<E>& operand){
+    return operand.self();
+}
+
+/**
+ * @brief Wrap a numeric operand as a Constant.
+ *
+ * @param operand Number.
+ * @return Constant node.
+ */
+inline Constant as_expression(double operand){
+    return Constant{operand};
+}
+
+/**
+ * @brief Node type stored for an operand of type T.
+ *
+ * @tparam T Expression node or arithmetic type.
+ */
+template <class T>
+using operand_t = std::decay_t<decltype(as_expression(std::declval<const T&>()))>;
+
+/**
+ * @brief Enabled for operand pairs where at least one side is an expression
+ * and the other is an expression or a number, so the operators below never
+ * capture unrelated types.
+ *
+ * @tparam L Left operand type.
+ * @tparam R Right operand type.
+ */
+template <class L, class R>
+using enable_binary = std::enable_if_t<
+    (is_expression<L>::value || is_expression<R>::value)
+        && (is_expression<L>::value || std::is_arithmetic<L>::value)
+        && (is_expression<R>::value || std::is_arithmetic<R>::value),
+    int
+>;
+
+/**
+ * @brief Node for l + r.
+ *
+ * @tparam L Left operand node.
+ * @tparam R Right operand node.
+ */
+template <class L, class R>
+struct Sum : Expression<Sum<L, R>> {
+    L left;
+    R right;
+
+    /**
+     * @brief Construct l + r.
+     *
+     * @param left Left operand.
+     * @param right Right operand.
+     */
+    Sum(const L& left, const R& right) : left(left), right(right) {}
+
+    /**
+     * @brief Evaluate l + r.
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        return left(x) + right(x);
+    }
+
+    /**
+     * @brief Derivative by the rule (l + r)' = l' + r'.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for l - r.
+ *
+ * @tparam L Left operand node.
+ * @tparam R Right operand node.
+ */
+template <class L, class R>
+struct Difference : Expression<Difference<L, R>> {
+    L left;
+    R right;
+
+    /**
+     * @brief Construct l - r.
+     *
+     * @param left Left operand.
+     * @param right Right operand.
+     */
+    Difference(const L& left, const R& right) : left(left), right(right) {}
+
+    /**
+     * @brief Evaluate l - r.
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        return left(x) - right(x);
+    }
+
+    /**
+     * @brief Derivative by the rule (l - r)' = l' - r'.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for l * r.
+ *
+ * @tparam L Left operand node.
+ * @tparam R Right operand node.
+ */
+template <class L, class R>
+struct Product : Expression<Product<L, R>> {
+    L left;
+    R right;
+
+    /**
+     * @brief Construct l * r.
+     *
+     * @param left Left operand.
+     * @param right Right operand.
+     */
+    Product(const L& left, const R& right) : left(left), right(right) {}
+
+    /**
+     * @brief Evaluate l * r.
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        return left(x) * right(x);
+    }
+
+    /**
+     * @brief Derivative by the rule (l r)' = l' r + l r'.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for l / r.
+ *
+ * @tparam L Left operand node.
+ * @tparam R Right operand node.
+ */
+template <class L, class R>
+struct Quotient : Expression<Quotient<L, R>> {
+    L left;
+    R right;
+
+    /**
+     * @brief Construct l / r.
+     *
+     * @param left Left operand.
+     * @param right Right operand.
+     */
+    Quotient(const L& left, const R& right) : left(left), right(right) {}
+
+    /**
+     * @brief Evaluate l / r.
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        return left(x) / right(x);
+    }
+
+    /**
+     * @brief Derivative by the rule (l / r)' = (l' r - l r') / r^2.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for -e.
+ *
+ * @tparam E Argument node.
+ */
+template <class E>
+struct Negation : Expression<Negation<E>> {
+    E arg;
+
+    /**
+     * @brief Construct -e.
+     *
+     * @param arg Argument.
+     */
+    explicit Negation(const E& arg) : arg(arg) {}
+
+    /**
+     * @brief Evaluate -e.
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        return -arg(x);
+    }
+
+    /**
+     * @brief Derivative by the rule (-e)' = -e'.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for exp(e).
+ *
+ * @tparam E Argument node.
+ */
+template <class E>
+struct Exp : Expression<Exp<E>> {
+    E arg;
+
+    /**
+     * @brief Construct exp(e).
+     *
+     * @param arg Argument.
+     */
+    explicit Exp(const E& arg) : arg(arg) {}
+
+    /**
+     * @brief Evaluate exp(e).
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        using std::exp;
+        return exp(arg(x));
+    }
+
+    /**
+     * @brief Derivative by the rule exp(e)' = exp(e) e'.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for log(e).
+ *
+ * @tparam E Argument node.
+ */
+template <class E>
+struct Log : Expression<Log<E>> {
+    E arg;
+
+    /**
+     * @brief Construct log(e).
+     *
+     * @param arg Argument.
+     */
+    explicit Log(const E& arg) : arg(arg) {}
+
+    /**
+     * @brief Evaluate log(e).
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        using std::log;
+        return log(arg(x));
+    }
+
+    /**
+     * @brief Derivative by the rule log(e)' = e' / e.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for sqrt(e).
+ *
+ * @tparam E Argument node.
+ */
+template <class E>
+struct Sqrt : Expression<Sqrt<E>> {
+    E arg;
+
+    /**
+     * @brief Construct sqrt(e).
+     *
+     * @param arg Argument.
+     */
+    explicit Sqrt(const E& arg) : arg(arg) {}
+
+    /**
+     * @brief Evaluate sqrt(e).
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        using std::sqrt;
+        return sqrt(arg(x));
+    }
+
+    /**
+     * @brief Derivative by the rule sqrt(e)' = e' / (2 sqrt(e)).
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for sin(e).
+ *
+ * @tparam E Argument node.
+ */
+template <class E>
+struct Sin : Expression<Sin<E>> {
+    E arg;
+
+    /**
+     * @brief Construct sin(e).
+     *
+     * @param arg Argument.
+     */
+    explicit Sin(const E& arg) : arg(arg) {}
+
+    /**
+     * @brief Evaluate sin(e).
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        using std::sin;
+        return sin(arg(x));
+    }
+
+    /**
+     * @brief Derivative by the rule sin(e)' = cos(e) e'.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for cos(e).
+ *
+ * @tparam E Argument node.
+ */
+template <class E>
+struct Cos : Expression<Cos<E>> {
+    E arg;
+
+    /**
+     * @brief Construct cos(e).
+     *
+     * @param arg Argument.
+     */
+    explicit Cos(const E& arg) : arg(arg) {}
+
+    /**
+     * @brief Evaluate cos(e).
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        using std::cos;
+        return cos(arg(x));
+    }
+
+    /**
+     * @brief Derivative by the rule cos(e)' = -sin(e) e'.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Node for e^n with an integer exponent.
+ *
+ * @tparam E Base node.
+ */
+template <class E>
+struct Power : Expression<Power<E>> {
+    E arg;
+    int exponent;
+
+    /**
+     * @brief Construct e^n.
+     *
+     * @param arg Base.
+     * @param exponent Integer exponent n.
+     */
+    Power(const E& arg, int exponent) : arg(arg), exponent(exponent) {}
+
+    /**
+     * @brief Evaluate e^n.
+     *
+     * @param x Point of evaluation.
+     * @return Value of the node at x.
+     */
+    template <class T> T operator()(const T& x) const {
+        using std::pow;
+        return pow(arg(x), exponent);
+    }
+
+    /**
+     * @brief Derivative by the rule (e^n)' = n e^(n-1) e'.
+     *
+     * @return Derivative expression.
+     */
+    auto derivative() const;
+};
+
+/**
+ * @brief Build l + r from expressions or numbers.
+ *
+ * @param left Left operand.
+ * @param right Right operand.
+ * @return Expression node.
+ */
+template <class L, class R, enable_binary<L, R> = 0> Sum<operand_t<L>, operand_t<R>> operator+(const L& left, const R& right){
+    return Sum<operand_t<L>, operand_t<R>>{as_expression(left), as_expression(right)};
+}
+
+/**
+ * @brief Build l - r from expressions or numbers.
+ *
+ * @param left Left operand.
+ * @param right Right operand.
+ * @return Expression node.
+ */
+template <class L, class R, enable_binary<L, R> = 0> Difference<operand_t<L>, operand_t<R>> operator-(const L& left, const R& right){
+    return Difference<operand_t<L>, operand_t<R>>{as_expression(left), as_expression(right)};
+}
+
+/**
+ * @brief Build l * r from expressions or numbers.
+ *
+ * @param left Left operand.
+ * @param right Right operand.
+ * @return Expression node.
+ */
+template <class L, class R, enable_binary<L, R> = 0> Product<operand_t<L>, operand_t<R>> operator*(const L& left, const R& right){
+    return Product<operand_t<L>, operand_t<R>>{as_expression(left), as_expression(right)};
+}
+
+/**
+ * @brief Build l / r from expressions or numbers.
+ *
+ * @param left Left operand.
+ * @param right Right operand.
+ * @return Expression node.
+ */
+template <class L, class R, enable_binary<L, R> = 0> Quotient<operand_t<L>, operand_t<R>> operator/(const L& left, const R& right){
+    return Quotient<operand_t<L>, operand_t<R>>{as_expression(left), as_expression(right)};
+}
+
+/**
+ * @brief Build -e.
+ *
+ * @param arg Expression.
+ * @return Expression node.
+ */
+template <class E> Negation<E> operator-(const Expression<E>& arg){
+    return Negation<E>{arg.self()};
+}
+
+/**
+ * @brief Build e^n.
+ *
+ * @param arg Expression.
+ * @param exponent Integer exponent.
+ * @return Expression node.
+ */
+template <class E> Power<E> pow(const Expression<E>& arg, int exponent){
+    return Power<E>{arg.self(), exponent};
+}
+
+/**
+ * @brief Build exp(e).
+ *
+ * @param arg Expression.
+ * @return Expression node.
+ */
+template <class E> Exp<E> exp(const Expression<E>& arg){
+    return Exp<E>{arg.self()};
+}
+
+/**
+ * @brief Build log(e).
+ *
+ * @param arg Expression.
+ * @return Expression node.
+ */
+template <class E> Log<E> log(const Expression<E>& arg){
+    return Log<E>{arg.self()};
+}
+
+/**
+ * @brief Build sqrt(e).
+ *
+ * @param arg Expression.
+ * @return Expression node.
+ */
+template <class E> Sqrt<E> sqrt(const Expression<E>& arg){
+    return Sqrt<E>{arg.self()};
+}
+
+/**
+ * @brief Build sin(e).
+ *
+ * @param arg Expression.
+ * @return Expression node.
+ */
+template <class E> Sin<E> sin(const Expression<E>& arg){
+    return Sin<E>{arg.self()};
+}
+
+/**
+ * @brief Build cos(e).
+ *
+ * @param arg Expression.
+ * @return Expression node.
+ */
+template <class E> Cos<E> cos(const Expression<E>& arg){
+    return Cos<E>{arg.self()};
+}
+
+/**
+ * @brief Derivative by the rule (l + r)' = l' + r'.
+ *
+ * @return Derivative expression.
+ */
+template <class L, class R> auto Sum<L, R>::derivative() const {
+    return left.derivative() + right.derivative();
+}
+
+/**
+ * @brief Derivative by the rule (l - r)' = l' - r'.
+ *
+ * @return Derivative expression.
+ */
+template <class L, class R> auto Difference<L, R>::derivative() const {
+    return left.derivative() - right.derivative();
+}
+
+/**
+ * @brief Derivative by the rule (l r)' = l' r + l r'.
+ *
+ * @return Derivative expression.
+ */
+template <class L, class R> auto Product<L, R>::derivative() const {
+    return left.derivative() * right + left * right.derivative();
+}
+
+/**
+ * @brief Derivative by the rule (l / r)' = (l' r - l r') / r^2.
+ *
+ * @return Derivative expression.
+ */
+template <class L, class R> auto Quotient<L, R>::derivative() const {
+    return (left.derivative() * right - left * right.derivative()) / (right * right);
+}
+
+/**
+ * @brief Derivative by the rule (-e)' = -e'.
+ *
+ * @return Derivative expression.
+ */
+template <class E> auto Negation<E>::derivative() const {
+    return -arg.derivative();
+}
+
+/**
+ * @brief Derivative by the rule exp(e)' = exp(e) e'.
+ *
+ * @return Derivative expression.
+ */
+template <class E> auto Exp<E>::derivative() const {
+    return Exp<E>{arg} * arg.derivative();
+}
+
+/**
+ * @brief Derivative by the rule log(e)' = e' / e.
+ *
+ * @return Derivative expression.
+ */
+template <class E> auto Log<E>::derivative() const {
+    return arg.derivative() / arg;
+}
+
+/**
+ * @brief Derivative by the rule sqrt(e)' = e' / (2 sqrt(e)).
+ *
+ * @return Derivative expression.
+ */
+template <class E> auto Sqrt<E>::derivative() const {
+    return arg.derivative() / (2.0 * Sqrt<E>{arg});
+}
+
+/**
+ * @brief Derivative by the rule sin(e)' = cos(e) e'.
+ *
+ * @return Derivative expression.
+ */
+template <class E> auto Sin<E>::derivative() const {
+    return Cos<E>{arg} * arg.derivative();
+}
+
+/**
+ * @brief Derivative by the rule cos(e)' = -sin(e) e'.
+ *
+ * @return Derivative expression.
+ */
+template <class E> auto Cos<E>::derivative() const {
+    return -(Sin<E>{arg} * arg.derivative());
+}
+
+/**
+ * @brief Derivative by the rule (e^n)' = n e^(n-1) e'.
+ *
+ * @return Derivative expression.
+ */
+template <class E> auto Power<E>::derivative() const {
+    return static_cast<double>(exponent) * Power<E>{arg, exponent - 1} * arg.derivative();
+}
+
+/**
+ * @brief Symbolic derivative of an expression.
+ *
+ * @param func Expression f.
+ * @return Expression for f'.
+ */
+template <class E> auto derivative(const Expression<E>& func){
+    return func.self().derivative();
+}
+
+}  // namespace expression
@@ -0,0 +1,170 @@
+#pragma once
+
+/**
+ * @brief Closed interval [lower, upper] with outward-rounded arithmetic.
+ *
+ * Every operation rounds its lower bound toward -inf and its upper bound
+ * toward +inf (one ulp outward via std::nextafter, two ulps for library
+ * transcendental functions), so the result of evaluating an expression on
+ * intervals is guaranteed to enclose every real value of the expression.
+ */
+class Interval {
+public:
+    double lower = 0.0;
+    double upper = 0.0;
+
+    /**
+     * @brief Construct the degenerate interval [0, 0].
+     */
+    Interval() = default;
+
+    /**
+     * @brief Construct the degenerate interval [value, value]; allows mixing
+     * doubles and intervals in arithmetic.
+     *
+     * @param value Point value.
+     */
+    Interval(double value);
+
+    /**
+     * @brief Construct the interval [lower, upper].
+     *
+     * @param lower Left endpoint.
+     * @param upper Right endpoint, upper >= lower.
+     */
+    Interval(double lower, double upper);
+
+    /**
+     * @brief Midpoint of the interval.
+     *
+     * @return (lower + upper) / 2.
+     */
+    double midpoint() const;
+
+    /**
+     * @brief Width of the interval.
+     *
+     * @return upper - lower.
+     */
+    double width() const;
+
+    /**
+     * @brief Whether x lies in the interval.
+     *
+     * @param x Point.
+     * @return lower <= x <= upper.
+     */
+    bool contains(double x) const;
+
+    /**
+     * @brief Whether other lies strictly inside the interval.
+     *
+     * @param other Interval.
+     * @return lower < other.lower and other.upper < upper.
+     */
+    bool interior_contains(const Interval& other) const;
+};
+
+/**
+ * @brief Intersect two intervals.
+ *
+ * @param a First interval.
+ * @param b Second interval.
+ * @param out Destination for a intersected with b when non-empty.
+ * @return Whether the intersection is non-empty.
+ */
+bool intersect(const Interval& a, const Interval& b, Interval& out);
+
+/**
+ * @brief Negate an interval.
+ *
+ * @param a Interval.
+ * @return -a.
+ */
+Interval operator-(const Interval& a);
+
+/**
+ * @brief Add two intervals.
+ *
+ * @param a Left operand.
+ * @param b Right operand.
+ * @return Enclosure of a + b.
+ */
+Interval operator+(const Interval& a, const Interval& b);
+
+/**
+ * @brief Subtract two intervals.
+ *
+ * @param a Left operand.
+ * @param b Right operand.
+ * @return Enclosure of a - b.
+ */
+Interval operator-(const Interval& a, const Interval& b);
+
+/**
+ * @brief Multiply two intervals.
+ *
+ * @param a Left operand.
+ * @param b Right operand.
+ * @return Enclosure of a * b.
+ */
+Interval operator*(const Interval& a, const Interval& b);
+
+/**
+ * @brief Divide two intervals. Throws std::domain_error if b contains zero.
+ *
+ * @param a Numerator.
+ * @param b Denominator.
+ * @return Enclosure of a / b.
+ */
+Interval operator/(const Interval& a, const Interval& b);
+
+/**
+ * @brief Raise an interval to an integer power.
+ *
+ * @param a Interval.
+ * @param p Integer exponent.
+ * @return Enclosure of a^p.
+ */
+Interval pow(const Interval& a, int p);
+
+/**
+ * @brief Exponential of an interval.
+ *
+ * @param a Interval.
+ * @return Enclosure of exp(a).
+ */
+Interval exp(const Interval& a);
+
+/**
+ * @brief Natural logarithm of an interval. Throws std::domain_error unless
+ * a.lower > 0.
+ *
+ * @param a Interval.
+ * @return Enclosure of log(a).
+ */
+Interval log(const Interval& a);
+
+/**
+ * @brief Square root of an interval. Throws std::domain_error if a.lower < 0.
+ *
+ * @param a Interval.
+ * @return Enclosure of sqrt(a).
+ */
+Interval sqrt(const Interval& a);
+
+/**
+ * @brief Sine of an interval.
+ *
+ * @param a Interval.
+ * @return Enclosure of sin(a).
+ */
+Interval sin(const Interval& a);
+
+/**
+ * @brief Cosine of an interval.
+ *
+ * @param a Interval.
+ * @return Enclosure of cos(a).
+ */
+Interval cos(const Interval& a);
@@ -0,0 +1,81 @@
+#pragma once
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Piecewise-Chebyshev table of the inverse x = f^-1(y) of a monotone
+ * function f on [a, b].
+ *
+ * f(x) = y is solved once at the Chebyshev points of every piece of an
+ * adaptive partition of the range of f, in parallel. Queries then cost a
+ * binary search and a Clenshaw evaluation. Each piece is stored contiguously
+ * as [center, 1 / half_width, c_0, ..., c_degree] in one flat array.
+ */
+class InverseTable {
+public:
+    /**
+     * @brief Build the inverse table.
+     *
+     * @param func Continuous, strictly monotone function f(x); must be
+     * thread-safe.
+     * @param a Left endpoint of the domain.
+     * @param b Right endpoint of the domain.
+     * @param degree Chebyshev degree of every piece.
+     * @param TOL Absolute tolerance on x for the trailing coefficients.
+     * @param num_threads Number of worker threads; values <= 0 use all cores.
+     */
+    InverseTable(
+        const std::function<double(double)>& func,
+        double a,
+        double b,
+        int degree,
+        double TOL,
+        int num_threads
+    );
+
+    /**
+     * @brief Approximate x with f(x) = y.
+     *
+     * @param y Value in the range of f.
+     * @param polish Whether to apply one Newton step on f(x) - y, using the
+     * table's dx/dy for the derivative; costs one evaluation of f.
+     * @return Approximate inverse at y.
+     */
+    double evaluate(double y, bool polish) const;
+
+    /**
+     * @brief Approximate x with f(x) = y for every entry of y.
+     *
+     * @param y Values in the range of f.
+     * @param polish Whether to apply one Newton step to every result.
+     * @return Approximate inverses, one per value.
+     */
+    std::vector<double> evaluate(const std::vector<double>& y, bool polish) const;
+
+    /**
+     * @brief Number of pieces in the partition.
+     *
+     * @return Piece count.
+     */
+    int pieces() const;
+
+    /**
+     * @brief Smallest value of f on [a, b].
+     *
+     * @return Lower end of the table range.
+     */
+    double lower() const;
+
+    /**
+     * @brief Largest value of f on [a, b].
+     *
+     * @return Upper end of the table range.
+     */
+    double upper() const;
+
+private:
+    std::function<double(double)> func_;
+    int degree_;
+    std::vector<double> breakpoints_;
+    std::vector<double> data_;
+};
@@ -0,0 +1,162 @@
+#pragma once
+#include <functional>
+#include <vector>
+#include "numeric/compiled_expression.hpp"
+#include "numeric/expression.hpp"
+#include "numeric/solve_options.hpp"
+
+/**
+ * @brief Function evaluated on n dense lanes at once: lane i holds problem
+ * problems[i] at the point x[i], and f[i] receives its value.
+ */
+using LaneFunction = std::function<void(const int* problems, const double* x, double* f, int n)>;
+
+/**
+ * @brief Function and derivative evaluated on n dense lanes at once: lane i
+ * holds problem problems[i] at the point x[i], and f[i] and df[i] receive its
+ * value and derivative.
+ */
+using LaneFunctionDerivative = std::function<void(const int* problems, const double* x, double* f, double* df, int n)>;
+
+/**
+ * @brief Per-problem results of a lane-batched solve, with the number of
+ * batch calls made and the fraction of lanes that held live problems.
+ */
+struct LaneBatchResult {
+    std::vector<double> roots;
+    std::vector<int> iterations;
+    std::vector<SolveStatus> status;
+    long long batch_calls = 0;
+    long long lane_evaluations = 0;
+    double utilization = 0.0;
+};
+
+/**
+ * @brief Approximate roots of many problems f_k(x) = 0 using the
+ * Newton-Raphson method (Algorithm 2.3 in "Numerical Analysis") on a fixed
+ * number of dense lanes.
+ *
+ * Problems are taken from a queue into lanes and iterated in lock step, one
+ * batch call per iteration. After every step the problems that converged or
+ * exhausted MAX_ITERS are retired, the remaining lanes are compacted to the
+ * front and the freed lanes are refilled from the queue, so every batch call
+ * works on up to lanes live problems regardless of how iteration counts vary.
+ * The order in which problems finish does not affect their results.
+ *
+ * @param func Function and derivative evaluated on a batch of lanes.
+ * @param x0 Initial approximations, one per problem.
+ * @param lanes Number of lanes, i.e. the largest batch passed to func.
+ * @param MAX_ITERS Maximum number of iterations per problem.
+ * @param TOL Convergence tolerance.
+ * @return Roots, iteration counts and statuses in problem order.
+ */
+LaneBatchResult newton_method_lanes(
+    const LaneFunctionDerivative& func,
+    const std::vector<double>& x0,
+    int lanes,
+    int MAX_ITERS,
+    double TOL
+);
+
+/**
+ * @brief Approximate roots of many problems f_k(x) = 0 using the Secant
+ * method (Algorithm 2.4 in "Numerical Analysis") on a fixed number of dense
+ * lanes, retiring, compacting and refilling lanes as in newton_method_lanes.
+ *
+ * A newly loaded lane spends its first batch call evaluating f_k(x0) so that
+ * new and running problems share every call.
+ *
+ * @param func Function evaluated on a batch of lanes.
+ * @param x0 First initial approximations, one per problem.
+ * @param x1 Second initial approximations, one per problem.
+ * @param lanes Number of lanes, i.e. the largest batch passed to func.
+ * @param MAX_ITERS Maximum number of iterations per problem.
+ * @param TOL Convergence tolerance.
+ * @return Roots, iteration counts and statuses in problem order.
+ */
+LaneBatchResult secant_method_lanes(
+    const LaneFunction& func,
+    const std::vector<double>& x0,
+    const std::vector<double>& x1,
+    int lanes,
+    int MAX_ITERS,
+    double TOL
+);
+
+/**
+ * @brief Approximate roots of parametrized problems f(p_k, x) = 0 using
+ * newton_method_lanes, with f' from the compiled expression's dual-number
+ * evaluation.
+ *
+ * @param func Compiled function of x with parameters p.
+ * @param x0 Initial approximations, one per problem.
+ * @param params No parameter sets, one shared by every problem, or one per
+ * problem.
+ * @param lanes Number of lanes.
+ * @param MAX_ITERS Maximum number of iterations per problem.
+ * @param TOL Convergence tolerance.
+ * @return Roots, iteration counts and statuses in problem order.
+ */
+LaneBatchResult newton_method_lanes(
+    const CompiledExpression& func,
+    const std::vector<double>& x0,
+    const std::vector<std::vector<double>>& params,
+    int lanes,
+    int MAX_ITERS,
+    double TOL
+);
+
+/**
+ * @brief Approximate roots of parametrized problems f(p_k, x) = 0 using
+ * secant_method_lanes.
+ *
+ * @param func Compiled function of x with parameters p.
+ * @param x0 First initial approximations, one per problem.
+ * @param x1 Second initial approximations, one per problem.
+ * @param params No parameter sets, one shared by every problem, or one per
+ * problem.
+ * @param lanes Number of lanes.
+ * @param MAX_ITERS Maximum number of iterations per problem.
+ * @param TOL Convergence tolerance.
+ * @return Roots, iteration counts and statuses in problem order.
+ */
+LaneBatchResult secant_method_lanes(
+    const CompiledExpression& func,
+    const std::vector<double>& x0,
+    const std::vector<double>& x1,
+    const std::vector<std::vector<double>>& params,
+    int lanes,
+    int MAX_ITERS,
+    double TOL
+);
+
+/**
+ * @brief Approximate roots of an expression template f(x) = 0 from many
+ * initial approximations using newton_method_lanes. f and its symbolic
+ * derivative are inlined into the lane loop, which the compiler can
+ * vectorize.
+ *
+ * @param func Differentiable expression f(x).
+ * @param x0 Initial approximations, one per problem.
+ * @param lanes Number of lanes.
+ * @param MAX_ITERS Maximum number of iterations per problem.
+ * @param TOL Convergence tolerance.
+ * @return Roots, iteration counts and statuses in problem order.
+ */
+template <class E> LaneBatchResult newton_method_lanes(
+    const expression::Expression<E>& func,
+    const std::vector<double>& x0,
+    int lanes,
+    int MAX_ITERS,
+    double TOL
+){
+    const E f = func.self();
+    const auto dfunc = f.derivative();
+    const LaneFunctionDerivative batch = [&f, &dfunc](const int*, const double* x, double* f_x, double* fdx_x, int n) {
+        for (int ii = 0; ii < n; ii++) {
+            f_x[ii] = f(x[ii]);
+            fdx_x[ii] = dfunc(x[ii]);
+        }
+    };
+    return newton_method_lanes(batch, x0, lanes, MAX_ITERS, TOL);
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Preallocated storage for Broyden's method on a system of n equations.
+ *
+ * Matrices are stored row-major in flat vectors so that repeated solves reuse
+ * the same allocations.
+ */
+struct BroydenWorkspace {
+    int n = 0;
+    std::vector<double> A;
+    std::vector<double> J;
+    std::vector<double> v;
+    std::vector<double> w;
+    std::vector<double> y;
+    std::vector<double> z;
+    std::vector<double> s;
+    std::vector<double> u;
+    std::vector<double> x_plus;
+    std::vector<double> x_minus;
+
+    /**
+     * @brief Construct an empty workspace, sized on first use.
+     */
+    BroydenWorkspace() = default;
+
+    /**
+     * @brief Construct a workspace for systems of n equations.
+     *
+     * @param n Number of equations and unknowns.
+     */
+    explicit BroydenWorkspace(int n);
+
+    /**
+     * @brief Resize the workspace for systems of n equations. Storage is only
+     * reallocated when n changes.
+     *
+     * @param n Number of equations and unknowns.
+     */
+    void resize(int n);
+};
+
+/**
+ * @brief Approximate the Jacobian matrix of F at x using centered differences.
+ *
+ * @param func Continuous function F: R^n -> R^n.
+ * @param x Point at which the Jacobian is evaluated.
+ * @param epsilon Small perturbation for numerical derivative.
+ * @return Row-major n x n matrix with entries dF_i / dx_j.
+ */
+std::vector<double> finite_difference_jacobian(
+    const std::function<std::vector<double>(const std::vector<double>&)>& func,
+    const std::vector<double>& x,
+    double epsilon
+);
+
+/**
+ * @brief Approximate a solution of F(x) = 0 using Broyden's method. Algorithm
+ * 10.2 in "Numerical Analysis".
+ *
+ * The Jacobian is approximated once at x0; afterwards the inverse is updated
+ * with the Sherman-Morrison formula so each iteration costs one evaluation of F.
+ *
+ * @param func Continuous function F: R^n -> R^n.
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance for the infinity norm of the step.
+ * @return Approximate x to solution F(x) = 0.
+ */
+std::vector<double> broyden_method(
+    const std::function<std::vector<double>(const std::vector<double>&)>& func,
+    std::vector<double> x0,
+    int MAX_ITERS,
+    double TOL
+);
+
+/**
+ * @brief Approximate a solution of F(x) = 0 using Broyden's method with a
+ * caller-provided workspace. Algorithm 10.2 in "Numerical Analysis".
+ *
+ * @param func Continuous function F: R^n -> R^n.
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance for the infinity norm of the step.
+ * @param workspace Storage reused across calls; resized to n if required.
+ * @return Approximate x to solution F(x) = 0.
+ */
+std::vector<double> broyden_method(
+    const std::function<std::vector<double>(const std::vector<double>&)>& func,
+    std::vector<double> x0,
+    int MAX_ITERS,
+    double TOL,
+    BroydenWorkspace& workspace
+);
+
+/**
+ * @brief Solve many independent systems F_k(x) = 0 with Broyden's method,
+ * sharing a single workspace between them.
+ *
+ * @param func Continuous function F(k, x) evaluating system k at x.
+ * @param x0 Initial approximations, one per system.
+ * @param MAX_ITERS Maximum number of iterations per system.
+ * @param TOL Convergence tolerance for the infinity norm of the step.
+ * @return Approximate solutions, one per system.
+ */
+std::vector<std::vector<double>> broyden_method_batch(
+    const std::function<std::vector<double>(int, const std::vector<double>&)>& func,
+    const std::vector<std::vector<double>>& x0,
+    int MAX_ITERS,
+    double TOL
+);
@@ -0,0 +1,328 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "numeric/expression.hpp"
+
+/**
+ * @brief Polynomial P(x) = c_0 x^N + c_1 x^(N-1) + ... + c_N of fixed degree
+ * N, with coefficients from highest to lowest degree as for horners.
+ *
+ * Horner evaluation is unrolled at compile time, so the coefficients and
+ * partial sums stay in registers. Polynomial is an expression node whose
+ * derivative() is again a Polynomial, so it can be passed directly to the
+ * expression-template overloads of newton_method, halley_method and
+ * newton_method_lanes.
+ *
+ * @tparam T Coefficient type.
+ * @tparam N Degree.
+ */
+template <class T, int N>
+class Polynomial : public expression::Expression<Polynomial<T, N>> {
+    static_assert(N >= 0, "Polynomial degree must be non-negative");
+
+public:
+    /**
+     * @brief Degree of the derivative and of a deflated polynomial; the
+     * derivative of a constant is the zero constant.
+     */
+    static constexpr int LOWER = N > 0 ? N - 1 : 0;
+
+    std::array<T, N + 1> coefs{};
+
+    /**
+     * @brief Construct the zero polynomial.
+     */
+    Polynomial() = default;
+
+    /**
+     * @brief Construct a polynomial from its coefficients.
+     *
+     * @param coefs Coefficients from highest to lowest degree.
+     */
+    Polynomial(const std::array<T, N + 1>& coefs) : coefs(coefs) {}
+
+    /**
+     * @brief Evaluate P(x) with unrolled Horner's method. Any type with
+     * arithmetic against T, such as Taylor numbers, can be the argument.
+     *
+     * @param x Point of evaluation.
+     * @return P(x).
+     */
+    template <class U> U operator()(const U& x) const {
+        return horner(x, std::make_index_sequence<N>{});
+    }
+
+    /**
+     * @brief Evaluate the polynomial P(x) and its derivative at x with
+     * unrolled Horner's method. Algorithm 2.7 in "Numerical Analysis".
+     *
+     * @param x Point of evaluation.
+     * @return Tuple of the polynomial and derivative at x.
+     */
+    std::tuple<T, T> evaluate_derivative(T x) const {
+        return horner_derivative(x, std::make_index_sequence<N>{});
+    }
+
+    /**
+     * @brief Evaluate P(x) and its first K derivatives at x by repeated
+     * synthetic division, unrolled over the coefficients.
+     *
+     * @tparam K Highest derivative order.
+     * @param x Point of evaluation.
+     * @return P(x), P'(x), ..., P^(K)(x).
+     */
+    template <int K> std::array<T, K + 1> evaluate_derivatives(T x) const {
+        static_assert(K >= 0, "Derivative order must be non-negative");
+        return horner_derivatives<K>(x, std::make_index_sequence<N>{});
+    }
+
+    /**
+     * @brief Derivative P'(x).
+     *
+     * @return Polynomial of degree N - 1, or zero when N is 0.
+     */
+    Polynomial<T, LOWER> derivative() const {
+        Polynomial<T, LOWER> result;
+        if constexpr (N > 0) {
+            for (int kk = 0; kk < N; kk++) {
+                result.coefs[kk] = coefs[kk] * static_cast<T>(N - kk);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Divide P(x) by (x - root) using synthetic division.
+     *
+     * @param root Root being removed, usually an approximation.
+     * @return Tuple of the quotient Q(x) of degree N - 1 and the remainder
+     * P(root), so that P(x) = (x - root) Q(x) + P(root).
+     */
+    std::tuple<Polynomial<T, LOWER>, T> deflate(T root) const {
+        static_assert(N >= 1, "Deflation expects a polynomial of degree at least one");
+        Polynomial<T, LOWER> quotient;
+        quotient.coefs[0] = coefs[0];
+        for (int kk = 1; kk < N; kk++) {
+            quotient.coefs[kk] = coefs[kk] + root * quotient.coefs[kk - 1];
+        }
+        return {quotient, coefs[N] + root * quotient.coefs[N - 1]};
+    }
+
+    /**
+     * @brief Real roots of a linear, quadratic, cubic or quartic polynomial in
+     * closed form.
+     *
+     * Quadratics use the cancellation-free form of the quadratic formula,
+     * cubics the trigonometric or Cardano solution and quartics Ferrari's
+     * resolvent cubic. Each root is then polished with Newton steps on P.
+     * A root of multiplicity two or more may be listed fewer times than its
+     * multiplicity.
+     *
+     * @return Real roots in ascending order.
+     */
+    std::vector<T> roots() const {
+        static_assert(N >= 1 && N <= 4, "Closed-form roots exist for degrees one to four");
+        if (coefs[0] == T(0)) {
+            throw std::invalid_argument("Polynomial roots expect a non-zero leading coefficient");
+        }
+        std::vector<T> result;
+        if constexpr (N == 1) {
+            result.push_back(-coefs[1] / coefs[0]);
+        } else if constexpr (N == 2) {
+            result = quadratic_roots(coefs[0], coefs[1], coefs[2]);
+        } else if constexpr (N == 3) {
+            result = cubic_roots(coefs[1] / coefs[0], coefs[2] / coefs[0], coefs[3] / coefs[0]);
+        } else {
+            result = quartic_roots(coefs[1] / coefs[0], coefs[2] / coefs[0], coefs[3] / coefs[0], coefs[4] / coefs[0]);
+        }
+        for (T& root : result) {
+            root = polish(root);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+private:
+    /**
+     * @brief Unrolled Horner evaluation of P(x).
+     *
+     * @param x Point of evaluation.
+     * @return P(x).
+     */
+    template <class U, std::size_t... I> U horner(const U& x, std::index_sequence<I...>) const {
+        U y = U(coefs[0]);
+        ((y = y * x + coefs[I + 1]), ...);
+        return y;
+    }
+
+    /**
+     * @brief Unrolled Horner evaluation of P(x) and P'(x).
+     *
+     * @param x Point of evaluation.
+     * @return Tuple of P(x) and P'(x).
+     */
+    template <std::size_t... I> std::tuple<T, T> horner_derivative(T x, std::index_sequence<I...>) const {
+        // Step 1
+        T y = coefs[0];
+        T z = T(0);
+
+        // Steps 2 and 3
+        ((z = z * x + y, y = y * x + coefs[I + 1]), ...);
+
+        // Step 4
+        return {y, z};
+    }
+
+    /**
+     * @brief Unrolled repeated synthetic division giving P and its first K
+     * derivatives.
+     *
+     * @param x Point of evaluation.
+     * @return P(x), P'(x), ..., P^(K)(x).
+     */
+    template <int K, std::size_t... I> std::array<T, K + 1> horner_derivatives(T x, std::index_sequence<I...>) const {
+        // b[k] accumulates P^(k)(x) / k!.
+        std::array<T, K + 1> b{};
+        b[0] = coefs[0];
+        const auto step = [&b, x](T coef) {
+            for (int kk = K; kk >= 1; kk--) {
+                b[kk] = b[kk] * x + b[kk - 1];
+            }
+            b[0] = b[0] * x + coef;
+        };
+        (step(coefs[I + 1]), ...);
+
+        T factorial = T(1);
+        for (int kk = 2; kk <= K; kk++) {
+            factorial *= static_cast<T>(kk);
+            b[kk] *= factorial;
+        }
+        return b;
+    }
+
+    /**
+     * @brief Improve a closed-form root with up to two Newton steps, keeping
+     * a step only if it reduces |P|.
+     *
+     * @param root Closed-form root.
+     * @return Polished root.
+     */
+    T polish(T root) const {
+        for (int iteration = 0; iteration < 2; iteration++) {
+            const auto [f_x, fdx_x] = evaluate_derivative(root);
+            if (f_x == T(0) || fdx_x == T(0)) {
+                break;
+            }
+            const T x = root - f_x / fdx_x;
+            if (std::abs((*this)(x)) >= std::abs(f_x)) {
+                break;
+            }
+            root = x;
+        }
+        return root;
+    }
+
+    /**
+     * @brief Real roots of a x^2 + b x + c without cancellation.
+     *
+     * @param a Leading coefficient, non-zero.
+     * @param b Linear coefficient.
+     * @param c Constant coefficient.
+     * @return Zero or two real roots.
+     */
+    static std::vector<T> quadratic_roots(T a, T b, T c){
+        const T discriminant = b * b - 4 * a * c;
+        if (discriminant < T(0)) {
+            return {};
+        }
+        const T q = -(b + std::copysign(std::sqrt(discriminant), b)) / 2;
+        if (q == T(0)) {
+            return {T(0), T(0)};
+        }
+        return {q / a, c / q};
+    }
+
+    /**
+     * @brief Real roots of x^3 + a x^2 + b x + c.
+     *
+     * @param a Quadratic coefficient.
+     * @param b Linear coefficient.
+     * @param c Constant coefficient.
+     * @return One, two or three real roots.
+     */
+    static std::vector<T> cubic_roots(T a, T b, T c){
+        const T Q = (a * a - 3 * b) / 9;
+        const T R = (2 * a * a * a - 9 * a * b + 27 * c) / 54;
+        const T Q3 = Q * Q * Q;
+        const T shift = a / 3;
+
+        // Three real roots; the slack keeps nearly repeated roots in this
+        // branch rather than losing them to rounding.
+        if (Q > T(0) && R * R <= Q3 * (1 + 64 * std::numeric_limits<T>::epsilon())) {
+            const T pi = std::acos(T(-1));
+            const T theta = std::acos(std::clamp(R / std::sqrt(Q3), T(-1), T(1)));
+            const T scale = -2 * std::sqrt(Q);
+            return {
+                scale * std::cos(theta / 3) - shift,
+                scale * std::cos((theta + 2 * pi) / 3) - shift,
+                scale * std::cos((theta - 2 * pi) / 3) - shift,
+            };
+        }
+
+        // One real root.
+        const T A = -std::copysign(std::cbrt(std::abs(R) + std::sqrt(R * R - Q3)), R);
+        const T B = A == T(0) ? T(0) : Q / A;
+        return {A + B - shift};
+    }
+
+    /**
+     * @brief Real roots of x^4 + a x^3 + b x^2 + c x + d by Ferrari's method.
+     *
+     * @param a Cubic coefficient.
+     * @param b Quadratic coefficient.
+     * @param c Linear coefficient.
+     * @param d Constant coefficient.
+     * @return Zero, two or four real roots.
+     */
+    static std::vector<T> quartic_roots(T a, T b, T c, T d){
+        // Depressed quartic y^4 + p y^2 + q y + r with x = y - a / 4.
+        const T shift = a / 4;
+        const T p = b - 3 * a * a / 8;
+        const T q = c - a * b / 2 + a * a * a / 8;
+        const T r = d - a * c / 4 + a * a * b / 16 - 3 * a * a * a * a / 256;
+
+        std::vector<T> result;
+        // A positive root m of the resolvent cubic splits the quartic into
+        // y^2 -/+ s y + (p / 2 + m +/- q / (2 s)) with s = sqrt(2 m).
+        T m = T(0);
+        if (q != T(0)) {
+            const std::vector<T> resolvent = Polynomial<T, 3>{{T(1), p, p * p / 4 - r, -q * q / 8}}.roots();
+            m = *std::max_element(resolvent.begin(), resolvent.end());
+        }
+        if (m <= T(0)) {
+            // Biquadratic: y^2 = z for each real root z of z^2 + p z + r.
+            for (T z : quadratic_roots(T(1), p, r)) {
+                if (z >= T(0)) {
+                    result.push_back(std::sqrt(z) - shift);
+                    result.push_back(-std::sqrt(z) - shift);
+                }
+            }
+            return result;
+        }
+        const T s = std::sqrt(2 * m);
+        for (T y : quadratic_roots(T(1), -s, p / 2 + m + q / (2 * s))) {
+            result.push_back(y - shift);
+        }
+        for (T y : quadratic_roots(T(1), s, p / 2 + m - q / (2 * s))) {
+            result.push_back(y - shift);
+        }
+        return result;
+    }
+};
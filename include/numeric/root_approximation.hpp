@@ -1,6 +1,23 @@
 #pragma once
+#include <cmath>
 #include <functional>
+#include <iostream>
+#include <stdexcept>
 #include <tuple>
+#include <vector>
+
+#include "numeric/expression.hpp"
+#include "numeric/interval.hpp"
+#include "numeric/solve_options.hpp"
+#include "numeric/taylor.hpp"
+
+/**
+ * @brief Verified enclosure of a root produced by interval_newton.
+ */
+struct RootEnclosure {
+    Interval enclosure;
+    bool unique = false;
+};
 
 /**
  * @brief Approximate a root of f(x) = 0 using the bisection method. Algorithm
@@ -21,6 +38,24 @@ double bisection(
     double TOL
 );
 
+/**
+ * @brief Approximate a root of f(x) = 0 using the bisection method under
+ * deadline, evaluation budget and cancellation limits. Algorithm 2.1 in
+ * "Numerical Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param a Left endpoint of the interval.
+ * @param b Right endpoint of the interval.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final half-interval width.
+ */
+SolveResult bisection(
+    const std::function<double(double)>& func,
+    double a,
+    double b,
+    const SolveOptions& options
+);
+
 /**
  * @brief Approximate a root of f(x) = 0 using the fixed point iteration method.
  * Algorithm 2.2 in "Numerical Analysis".
@@ -38,6 +73,22 @@ double fixed_point(
     double TOL
 );
 
+/**
+ * @brief Approximate a fixed point x = g(x) using fixed point iteration under
+ * deadline, evaluation budget and cancellation limits. Algorithm 2.2 in
+ * "Numerical Analysis". The monitored residual is g(x) - x.
+ *
+ * @param func Continuous function g(x).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult fixed_point(
+    const std::function<double(double)>& func,
+    double x0,
+    const SolveOptions& options
+);
+
 /**
  * @brief First Derivative Point Approximation
  *
@@ -69,6 +120,379 @@ double newton_method(
     double TOL
 );
 
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method under
+ * deadline, evaluation budget and cancellation limits. Algorithm 2.3 in
+ * "Numerical Analysis". The two evaluations of each finite-difference
+ * derivative count towards the budget.
+ *
+ * @param func Continuous function f(x).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult newton_method(
+    const std::function<double(double)>& func,
+    double x0,
+    const SolveOptions& options
+);
+
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method with a
+ * known derivative. Algorithm 2.3 in "Numerical Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param dfunc Derivative f'(x).
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0 with initial approximation.
+ */
+double newton_method(
+    const std::function<double(double)>& func,
+    const std::function<double(double)>& dfunc,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+);
+
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method with a
+ * known derivative under deadline, evaluation budget and cancellation limits.
+ * Algorithm 2.3 in "Numerical Analysis". Only evaluations of f count towards
+ * the budget.
+ *
+ * @param func Continuous function f(x).
+ * @param dfunc Derivative f'(x).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult newton_method(
+    const std::function<double(double)>& func,
+    const std::function<double(double)>& dfunc,
+    double x0,
+    const SolveOptions& options
+);
+
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method with
+ * f and f' returned together by one call, as from a derivative tape.
+ * Algorithm 2.3 in "Numerical Analysis".
+ *
+ * @param func_derivative Function returning the tuple (f(x), f'(x)).
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0 with initial approximation.
+ */
+double newton_method(
+    const std::function<std::tuple<double, double>(double)>& func_derivative,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+);
+
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method with
+ * f and f' returned together by one call, under deadline, evaluation budget
+ * and cancellation limits. Algorithm 2.3 in "Numerical Analysis". Each call
+ * counts as one evaluation.
+ *
+ * @param func_derivative Function returning the tuple (f(x), f'(x)).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult newton_method(
+    const std::function<std::tuple<double, double>(double)>& func_derivative,
+    double x0,
+    const SolveOptions& options
+);
+
+/**
+ * @brief Approximate a root of f(x) = 0 using Halley's method. f, f' and f''
+ * are obtained from a single evaluation of func on a second-order Taylor
+ * variable, giving cubic convergence near simple roots.
+ *
+ * @param func Twice differentiable function f(x) written for Taylor<2> inputs.
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0 with initial approximation.
+ */
+double halley_method(
+    const std::function<Taylor<2>(const Taylor<2>&)>& func,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+);
+
+/**
+ * @brief Approximate a root of f(x) = 0 using Halley's method under deadline,
+ * evaluation budget and cancellation limits.
+ *
+ * @param func Twice differentiable function f(x) written for Taylor<2> inputs.
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult halley_method(
+    const std::function<Taylor<2>(const Taylor<2>&)>& func,
+    double x0,
+    const SolveOptions& options
+);
+
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method on an
+ * expression template. Algorithm 2.3 in "Numerical Analysis" with f' formed
+ * symbolically at compile time instead of by finite differences.
+ *
+ * Only expression::Expression nodes bind to this overload; lambdas and other
+ * callables keep using the std::function overload.
+ *
+ * @param func Differentiable expression f(x).
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0 with initial approximation.
+ */
+template <class E> double newton_method(
+    const expression::Expression<E>& func,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+){
+    const E& f = func.self();
+    const auto dfunc = f.derivative();
+    double fdx_x, x = x0;
+
+    // Step 1
+    int iteration = 1;
+
+    // Step 2
+    while (iteration <= MAX_ITERS) {
+        // Step 3
+        fdx_x = dfunc(x0);
+        x = x0 - f(x0) / fdx_x;
+
+        // Step 4
+        if (std::abs(x - x0) < TOL) {
+            return x;
+        }
+
+        // Step 5
+        iteration += 1;
+
+        // Step 6
+        x0 = x;
+    }
+
+    // Step 7
+    std::cerr << "Newton's Method not converged after " << MAX_ITERS << " iterations. "
+              << "Final tolerance is " << std::abs(x - x0) << std::endl;
+    return x;
+}
+
+/**
+ * @brief Approximate a root of f(x) = 0 using Halley's method on an expression
+ * template, with f' and f'' formed symbolically at compile time.
+ *
+ * @param func Twice differentiable expression f(x).
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0 with initial approximation.
+ */
+template <class E> double halley_method(
+    const expression::Expression<E>& func,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+){
+    const E& f = func.self();
+    const auto dfunc = f.derivative();
+    const auto d2func = dfunc.derivative();
+    double f_x, fdx_x, fdx2_x, denominator, x = x0;
+
+    // Step 1
+    int iteration = 1;
+
+    // Step 2
+    while (iteration <= MAX_ITERS) {
+        // Step 3
+        f_x = f(x0);
+        fdx_x = dfunc(x0);
+        fdx2_x = d2func(x0);
+        if (f_x == 0.0) {
+            return x0;
+        }
+        denominator = 2 * fdx_x * fdx_x - f_x * fdx2_x;
+        if (denominator == 0.0) {
+            throw std::runtime_error("Halley's method encountered zero denominator");
+        }
+        x = x0 - 2 * f_x * fdx_x / denominator;
+
+        // Step 4
+        if (std::abs(x - x0) < TOL) {
+            return x;
+        }
+
+        // Step 5
+        iteration += 1;
+
+        // Step 6
+        x0 = x;
+    }
+
+    // Step 7
+    std::cerr << "Halley's Method not converged after " << MAX_ITERS << " iterations. "
+              << "Final tolerance is " << std::abs(x - x0) << std::endl;
+    return x;
+}
+
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method on an
+ * expression template under deadline, evaluation budget and cancellation
+ * limits, with f' formed symbolically at compile time.
+ *
+ * @param func Differentiable expression f(x).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+template <class E> SolveResult newton_method(
+    const expression::Expression<E>& func,
+    double x0,
+    const SolveOptions& options
+){
+    const E& f = func.self();
+    const auto dfunc = f.derivative();
+    return newton_method(
+        [&f](double x) { return f(x); },
+        [&dfunc](double x) { return dfunc(x); },
+        x0,
+        options
+    );
+}
+
+/**
+ * @brief Approximate a root of f(x) = 0 using Halley's method on an
+ * expression template under deadline, evaluation budget and cancellation
+ * limits, with f' and f'' formed symbolically at compile time.
+ *
+ * @param func Twice differentiable expression f(x).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+template <class E> SolveResult halley_method(
+    const expression::Expression<E>& func,
+    double x0,
+    const SolveOptions& options
+){
+    const E& f = func.self();
+    const auto dfunc = f.derivative();
+    const auto d2func = dfunc.derivative();
+    // Halley's method only evaluates f on Taylor<2>::variable(x), whose
+    // expansion is f(x) + f'(x) h + f''(x) h^2 / 2.
+    const std::function<Taylor<2>(const Taylor<2>&)> series = [&f, &dfunc, &d2func](const Taylor<2>& x) {
+        Taylor<2> result{f(x.value())};
+        result.coefs[1] = dfunc(x.value());
+        result.coefs[2] = 0.5 * d2func(x.value());
+        return result;
+    };
+    return halley_method(series, x0, options);
+}
+
+/**
+ * @brief Approximate a root of f(x) = 0 using Householder's method of order D
+ * under deadline, evaluation budget and cancellation limits. Each iteration
+ * steps to x + g_(D-1) / g_D, where g_k are the Taylor coefficients of 1/f.
+ *
+ * @tparam D Order of the method, D >= 1.
+ * @param func Function f(x) written for Taylor<D> inputs.
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+template <int D> SolveResult householder_method(
+    const std::function<Taylor<D>(const Taylor<D>&)>& func,
+    double x0,
+    const SolveOptions& options
+){
+    static_assert(D >= 1, "Householder's method requires order D >= 1");
+    EvaluationMonitor monitor{options, x0};
+    int iteration = 0;
+    try {
+        double x = x0;
+
+        // Step 1
+        iteration = 1;
+
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            const Taylor<D> f_x = monitor.evaluate(func, x0);
+            if (f_x.value() == 0.0) {
+                return monitor.finish(x0, SolveStatus::CONVERGED, iteration, 0.0);
+            }
+            const Taylor<D> g_x = Taylor<D>{1.0} / f_x;
+            if (g_x.coefs[D] == 0.0) {
+                throw std::runtime_error("Householder's method encountered zero denominator");
+            }
+            x = x0 + g_x.coefs[D - 1] / g_x.coefs[D];
+
+            // Step 4
+            if (std::abs(x - x0) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, std::abs(x - x0));
+            }
+
+            // Step 5
+            iteration += 1;
+
+            // Step 6
+            x0 = x;
+        }
+
+        // Step 7
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(x - x0));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
+    }
+}
+
+/**
+ * @brief Approximate a root of f(x) = 0 using Householder's method of order D.
+ * The update x - D (1/f)^(D-1) / (1/f)^(D) is formed from the Taylor
+ * coefficients g_k of 1/f as x + g_(D-1) / g_D, so each iteration costs one
+ * evaluation of func and converges with order D + 1. D = 1 is Newton's method
+ * and D = 2 is Halley's method.
+ *
+ * @tparam D Order of the method, D >= 1.
+ * @param func Function f(x) written for Taylor<D> inputs.
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0 with initial approximation.
+ */
+template <int D> double householder_method(
+    const std::function<Taylor<D>(const Taylor<D>&)>& func,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+){
+    SolveOptions options;
+    options.max_iters = MAX_ITERS;
+    options.tol = TOL;
+    const SolveResult result = householder_method<D>(func, x0, options);
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Householder's Method not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
+    }
+    return result.root;
+}
+
 /**
  * @brief Approximate a root of f(x) = 0 using the secant method. Algorithm
  * 2.4 in "Numerical Analysis".
@@ -88,6 +512,24 @@ double secant_method(
     double TOL
 );
 
+/**
+ * @brief Approximate a root of f(x) = 0 using the secant method under deadline,
+ * evaluation budget and cancellation limits. Algorithm 2.4 in "Numerical
+ * Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param x0 First initial approximation.
+ * @param x1 Second initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult secant_method(
+    const std::function<double(double)>& func,
+    double x0,
+    double x1,
+    const SolveOptions& options
+);
+
 /**
  * @brief Approximate a root of f(x) = 0 using the false position method. Algorithm
  * 2.5 in "Numerical Analysis".
@@ -107,6 +549,24 @@ double false_position(
     double TOL
 );
 
+/**
+ * @brief Approximate a root of f(x) = 0 using the false position method under
+ * deadline, evaluation budget and cancellation limits. Algorithm 2.5 in
+ * "Numerical Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param x0 First initial approximation.
+ * @param x1 Second initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is |f| at the retained endpoint.
+ */
+SolveResult false_position(
+    const std::function<double(double)>& func,
+    double x0,
+    double x1,
+    const SolveOptions& options
+);
+
 /**
  * @brief Find a solution to f(x) = x using Steffensen's method. Algorithm
  * 2.6 in "Numerical Analysis".
@@ -124,6 +584,22 @@ double steffensen_method(
     double TOL
 );
 
+/**
+ * @brief Find a solution to g(x) = x using Steffensen's method under deadline,
+ * evaluation budget and cancellation limits. Algorithm 2.6 in "Numerical
+ * Analysis". The monitored residual is g(x) - x.
+ *
+ * @param func Continuous function g(x).
+ * @param x0 First initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult steffensen_method(
+    const std::function<double(double)>& func,
+    double x0,
+    const SolveOptions& options
+);
+
 /**
  * @brief Evaluate the polynomial P(x) and its derivative at x0 using Horner's
  * method. Algorithm 2.7 in "Numerical Analysis".
@@ -135,6 +611,30 @@ double steffensen_method(
  */
 std::tuple<double, double> horners(int n, const double coefs[], double x0);
 
+/**
+ * @brief Evaluate the polynomial P(x) and its derivative at count points using
+ * Horner's method, writing into caller-provided arrays without allocating.
+ *
+ * Points are processed in fixed-size blocks with the coefficient loop outside
+ * the point loop, so the inner loop is vectorizable. Each block of x is read
+ * before its results are written, so values or derivatives may alias x.
+ *
+ * @param n The degree of the polynomial.
+ * @param coefs List of length n+1 of polynomial coefficients.
+ * @param x Points that are being evaluated.
+ * @param values Receives P(x[i]).
+ * @param derivatives Receives P'(x[i]).
+ * @param count Number of points.
+ */
+void horners_batch(
+    int n,
+    const double coefs[],
+    const double x[],
+    double values[],
+    double derivatives[],
+    long long count
+);
+
 /**
  * @brief Find a solution to f(x) = 0 given 3 approximations using Muller's
  * method. Algorithm 2.8 in "Numerical Analysis".
@@ -155,3 +655,78 @@ double mullers(
     int MAX_ITERS,
     double TOL
 );
+
+/**
+ * @brief Find a solution to f(x) = 0 given 3 approximations using Muller's
+ * method under deadline, evaluation budget and cancellation limits. Algorithm
+ * 2.8 in "Numerical Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param p0 First initial approximation.
+ * @param p1 Second initial approximation.
+ * @param p2 Third initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |h|.
+ */
+SolveResult mullers(
+    const std::function<double(double)>& func,
+    double p0,
+    double p1,
+    double p2,
+    const SolveOptions& options
+);
+
+/**
+ * @brief Enclose every root of f(x) = 0 on [a, b] using the interval Newton
+ * method with bisection, processing the subdivision tree in parallel.
+ *
+ * A box X is discarded when F(X) excludes zero. Otherwise it is contracted to
+ * X intersected with N(X) = m - f(m) / F'(X), or bisected when F'(X) contains
+ * zero or the contraction stalls. When N(X) lies inside X the box contains
+ * exactly one root and the enclosure is flagged unique. Roots outside every
+ * reported enclosure are impossible; enclosures not flagged unique may hold
+ * several roots (e.g. a multiple root) or none.
+ *
+ * @param func Interval extension F of f; must be thread-safe.
+ * @param dfunc Interval extension F' of f'; must be thread-safe.
+ * @param a Left endpoint of the domain.
+ * @param b Right endpoint of the domain.
+ * @param MAX_ITERS Maximum subdivision depth of any branch.
+ * @param TOL Width below which an enclosure is reported.
+ * @param num_threads Number of worker threads; values <= 0 use all cores.
+ * @return Enclosures sorted by lower endpoint.
+ */
+std::vector<RootEnclosure> interval_newton(
+    const std::function<Interval(const Interval&)>& func,
+    const std::function<Interval(const Interval&)>& dfunc,
+    double a,
+    double b,
+    int MAX_ITERS,
+    double TOL,
+    int num_threads
+);
+
+/**
+ * @brief Find every root of f(x) = 0 on [a, b] from a Chebyshev proxy.
+ *
+ * f is sampled at Chebyshev points of increasing degree until its interpolant
+ * is resolved to TOL; the roots of the interpolant are the eigenvalues of its
+ * colleague matrix, polished with Newton steps using Clenshaw's recurrence.
+ * Intervals needing a degree above MAX_DEGREE are split in two and solved
+ * recursively. Suited to smooth functions, for which far fewer evaluations
+ * are needed than by scanning with bisection.
+ *
+ * @param func Smooth function f(x).
+ * @param a Left endpoint of the interval.
+ * @param b Right endpoint of the interval.
+ * @param MAX_DEGREE Largest interpolant degree before subdividing.
+ * @param TOL Relative tolerance for the Chebyshev coefficients.
+ * @return Sorted roots in [a, b].
+ */
+std::vector<double> chebyshev_roots(
+    const std::function<double(double)>& func,
+    double a,
+    double b,
+    int MAX_DEGREE,
+    double TOL
+);
@@ -0,0 +1,216 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "numeric/solve_options.hpp"
+
+/**
+ * @brief Bounded cache of roots of parametrized problems f(p, x) = 0, keyed by
+ * the parameter vector p.
+ *
+ * Entries live in a hashed grid of cells with side cell_size. An exact match
+ * on p returns the cached root without evaluating f. Otherwise the nearest
+ * entry in the surrounding cells is used as a warm start. Only converged
+ * roots are stored. Once capacity entries are stored, the least recently used
+ * one is evicted. All members are thread-safe; the solves themselves run
+ * outside the lock.
+ */
+class SolutionCache {
+public:
+    /**
+     * @brief Construct an empty cache.
+     *
+     * @param dimension Length of every parameter vector.
+     * @param cell_size Side of a grid cell; warm starts are drawn from
+     * entries within about one cell of the query.
+     * @param capacity Maximum number of stored roots.
+     */
+    SolutionCache(int dimension, double cell_size, int capacity);
+
+    /**
+     * @brief Approximate a root of f(p, x) = 0 with the Newton-Raphson method,
+     * starting from the nearest cached root when one exists.
+     *
+     * @param func Continuous function f(p, x).
+     * @param params Parameter vector p.
+     * @param x0 Initial approximation used on a cache miss.
+     * @param MAX_ITERS Maximum number of iterations.
+     * @param TOL Convergence tolerance.
+     * @return Approximate x to solution f(p, x) = 0.
+     */
+    double newton_method(
+        const std::function<double(const std::vector<double>&, double)>& func,
+        const std::vector<double>& params,
+        double x0,
+        int MAX_ITERS,
+        double TOL
+    );
+
+    /**
+     * @brief Approximate a root of f(p, x) = 0 with the Secant method. A warm
+     * start r uses r and r + 1e-3 (1 + |r|) as the initial approximations.
+     *
+     * @param func Continuous function f(p, x).
+     * @param params Parameter vector p.
+     * @param x0 First initial approximation used on a cache miss.
+     * @param x1 Second initial approximation used on a cache miss.
+     * @param MAX_ITERS Maximum number of iterations.
+     * @param TOL Convergence tolerance.
+     * @return Approximate x to solution f(p, x) = 0.
+     */
+    double secant_method(
+        const std::function<double(const std::vector<double>&, double)>& func,
+        const std::vector<double>& params,
+        double x0,
+        double x1,
+        int MAX_ITERS,
+        double TOL
+    );
+
+    /**
+     * @brief Approximate a root of f(p, x) = 0 with the Newton-Raphson method
+     * under deadline, evaluation budget and cancellation limits, starting from
+     * the nearest cached root when one exists. An exact hit reports CONVERGED
+     * with no iterations or evaluations.
+     *
+     * @param func Continuous function f(p, x).
+     * @param params Parameter vector p.
+     * @param x0 Initial approximation used on a cache miss.
+     * @param options Iteration, tolerance and resource limits.
+     * @return Solve result.
+     */
+    SolveResult newton_method(
+        const std::function<double(const std::vector<double>&, double)>& func,
+        const std::vector<double>& params,
+        double x0,
+        const SolveOptions& options
+    );
+
+    /**
+     * @brief Approximate a root of f(p, x) = 0 with the Secant method under
+     * deadline, evaluation budget and cancellation limits, warm-starting as
+     * in the overload without options.
+     *
+     * @param func Continuous function f(p, x).
+     * @param params Parameter vector p.
+     * @param x0 First initial approximation used on a cache miss.
+     * @param x1 Second initial approximation used on a cache miss.
+     * @param options Iteration, tolerance and resource limits.
+     * @return Solve result.
+     */
+    SolveResult secant_method(
+        const std::function<double(const std::vector<double>&, double)>& func,
+        const std::vector<double>& params,
+        double x0,
+        double x1,
+        const SolveOptions& options
+    );
+
+    /**
+     * @brief Find the cached root nearest to params and mark it recently used.
+     * Does not update the hit counters.
+     *
+     * @param params Parameter vector p.
+     * @param root Destination for the nearest cached root.
+     * @param exact Set to whether the entry matches params exactly.
+     * @return Whether any entry lies in the neighbouring cells.
+     */
+    bool nearest(const std::vector<double>& params, double& root, bool& exact);
+
+    /**
+     * @brief Store a root, replacing any entry with identical parameters and
+     * evicting the least recently used entry when full.
+     *
+     * @param params Parameter vector p.
+     * @param root Root of f(p, x) = 0.
+     */
+    void insert(const std::vector<double>& params, double root);
+
+    /**
+     * @brief Remove every entry and reset the counters.
+     */
+    void clear();
+
+    /**
+     * @brief Number of stored roots.
+     *
+     * @return Entry count.
+     */
+    int size() const;
+
+    /**
+     * @brief Number of solves answered by an exact match.
+     *
+     * @return Hit count.
+     */
+    long long hits() const;
+
+    /**
+     * @brief Number of solves started from a neighbouring cached root.
+     *
+     * @return Warm start count.
+     */
+    long long warm_starts() const;
+
+    /**
+     * @brief Number of solves started from the caller's approximation.
+     *
+     * @return Miss count.
+     */
+    long long misses() const;
+
+    /**
+     * @brief Fraction of solves answered by an exact match.
+     *
+     * @return hits / (hits + warm_starts + misses), or 0 before any solve.
+     */
+    double hit_rate() const;
+
+private:
+    struct Entry {
+        std::vector<double> params;
+        std::vector<long long> cell;
+        double root;
+    };
+
+    struct CellHash {
+        /**
+         * @brief Combine the cell indices into one hash.
+         *
+         * @param cell Integer grid coordinates.
+         * @return Hash value.
+         */
+        std::size_t operator()(const std::vector<long long>& cell) const;
+    };
+
+    /**
+     * @brief Grid cell containing params.
+     *
+     * @param params Parameter vector p.
+     * @return Integer grid coordinates.
+     */
+    std::vector<long long> cell_of(const std::vector<double>& params) const;
+
+    /**
+     * @brief Look up the warm start for a solve and update the counters.
+     *
+     * @param params Parameter vector p.
+     * @param root Destination for the cached root.
+     * @return 0 on a miss, 1 on a warm start and 2 on an exact hit.
+     */
+    int lookup(const std::vector<double>& params, double& root);
+
+    int dimension_;
+    double cell_size_;
+    int capacity_;
+    std::list<Entry> entries_;
+    std::unordered_map<std::vector<long long>, std::vector<std::list<Entry>::iterator>, CellHash> cells_;
+    long long hits_ = 0;
+    long long warm_starts_ = 0;
+    long long misses_ = 0;
+    mutable std::mutex mutex_;
+};
@@ -0,0 +1,204 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <tuple>
+
+#include "numeric/taylor.hpp"
+
+/**
+ * @brief Reason a solve stopped.
+ */
+enum class SolveStatus {
+    CONVERGED,
+    MAX_ITERATIONS,
+    DEADLINE_EXCEEDED,
+    BUDGET_EXHAUSTED,
+    CANCELLED
+};
+
+/**
+ * @brief Shared flag for stopping a running solve from another thread. Copies
+ * refer to the same flag.
+ */
+class CancellationToken {
+public:
+    /**
+     * @brief Create a token that has not been cancelled.
+     */
+    CancellationToken();
+
+    /**
+     * @brief Request cancellation; solves holding a copy stop before their
+     * next function evaluation.
+     */
+    void cancel() const;
+
+    /**
+     * @brief Whether cancellation was requested.
+     *
+     * @return Cancellation state.
+     */
+    bool cancelled() const;
+
+private:
+    std::shared_ptr<std::atomic<bool>> flag_;
+};
+
+/**
+ * @brief Stopping criteria for a solve. The defaults impose no deadline, no
+ * evaluation budget and no cancellation.
+ */
+struct SolveOptions {
+    int max_iters = 100;
+    double tol = 1e-8;
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    long long max_evaluations = 0;
+    std::optional<CancellationToken> cancellation;
+
+    /**
+     * @brief Set the deadline relative to now.
+     *
+     * @param seconds Wall-clock budget in seconds.
+     */
+    void set_timeout(double seconds);
+};
+
+/**
+ * @brief Outcome of a solve.
+ *
+ * root is the converged approximation, or after an interruption the
+ * evaluated point with the smallest |f|, which is reported in residual.
+ * bracket_lower and bracket_upper hold the tightest sign change observed, or
+ * NaN when none was seen. error is the method's final convergence measure,
+ * e.g. |x_n - x_(n-1)|.
+ */
+struct SolveResult {
+    double root = std::numeric_limits<double>::quiet_NaN();
+    SolveStatus status = SolveStatus::MAX_ITERATIONS;
+    int iterations = 0;
+    long long evaluations = 0;
+    double residual = std::numeric_limits<double>::infinity();
+    double error = std::numeric_limits<double>::quiet_NaN();
+    double bracket_lower = std::numeric_limits<double>::quiet_NaN();
+    double bracket_upper = std::numeric_limits<double>::quiet_NaN();
+};
+
+/**
+ * @brief Internal exception unwinding a solve when a limit is reached; caught
+ * by the method and turned into a SolveResult.
+ */
+struct SolveInterrupted {
+    SolveStatus status;
+};
+
+/**
+ * @brief Wraps every function evaluation of a solve: enforces the deadline,
+ * evaluation budget and cancellation, and tracks the point with the smallest
+ * |f| and the tightest sign-change bracket.
+ */
+class EvaluationMonitor {
+public:
+    /**
+     * @brief Start monitoring a solve.
+     *
+     * @param options Limits to enforce; must outlive the monitor.
+     * @param x0 Estimate reported if the solve stops before any evaluation.
+     */
+    EvaluationMonitor(const SolveOptions& options, double x0);
+
+    /**
+     * @brief Throw SolveInterrupted if any limit has been reached.
+     */
+    void check() const;
+
+    /**
+     * @brief Record an evaluated point.
+     *
+     * @param x Point of evaluation.
+     * @param residual Signed residual at x, e.g. f(x).
+     */
+    void record(double x, double residual);
+
+    /**
+     * @brief Check the limits, evaluate f(x) and record it.
+     *
+     * @param func Function f(x).
+     * @param x Point of evaluation.
+     * @return f(x).
+     */
+    double evaluate(const std::function<double(double)>& func, double x);
+
+    /**
+     * @brief Check the limits, evaluate f(x) and f'(x) with one call and
+     * record f(x).
+     *
+     * @param func Function returning the tuple (f(x), f'(x)).
+     * @param x Point of evaluation.
+     * @return Tuple of f(x) and f'(x).
+     */
+    std::tuple<double, double> evaluate_derivative(const std::function<std::tuple<double, double>(double)>& func, double x);
+
+    /**
+     * @brief Check the limits, evaluate g(x) for a fixed-point problem and
+     * record the residual g(x) - x.
+     *
+     * @param func Function g(x).
+     * @param x Point of evaluation.
+     * @return g(x).
+     */
+    double evaluate_fixed_point(const std::function<double(double)>& func, double x);
+
+    /**
+     * @brief Check the limits, evaluate f on a Taylor variable at x and record
+     * its value.
+     *
+     * @param func Function f written for Taylor<N> inputs.
+     * @param x Point of evaluation.
+     * @return Taylor expansion of f at x.
+     */
+    template <int N> Taylor<N> evaluate(const std::function<Taylor<N>(const Taylor<N>&)>& func, double x){
+        check();
+        evaluations_ += 1;
+        const Taylor<N> f_x = func(Taylor<N>::variable(x));
+        record(x, f_x.value());
+        return f_x;
+    }
+
+    /**
+     * @brief Result of a solve that ran to completion.
+     *
+     * @param root Final approximation.
+     * @param status CONVERGED or MAX_ITERATIONS.
+     * @param iterations Iterations performed.
+     * @param error Final convergence measure.
+     * @return Solve result.
+     */
+    SolveResult finish(double root, SolveStatus status, int iterations, double error) const;
+
+    /**
+     * @brief Result of a solve stopped by a limit, reporting the best
+     * evaluated point.
+     *
+     * @param interrupt Exception carrying the reason.
+     * @param iterations Iterations performed.
+     * @return Solve result.
+     */
+    SolveResult interrupted(const SolveInterrupted& interrupt, int iterations) const;
+
+private:
+    const SolveOptions& options_;
+    long long evaluations_ = 0;
+    double best_x_;
+    double best_residual_ = std::numeric_limits<double>::infinity();
+    bool has_last_ = false;
+    double last_x_ = 0.0;
+    double last_residual_ = 0.0;
+    bool has_bracket_ = false;
+    double lower_ = 0.0;
+    double upper_ = 0.0;
+    double residual_lower_ = 0.0;
+};
@@ -0,0 +1,287 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "numeric/compiled_expression.hpp"
+#include "numeric/solve_options.hpp"
+#include "numeric/streaming.hpp"
+#include "numeric/thread_pool.hpp"
+
+/**
+ * @brief Version of the wire protocol between SolverServer and its clients.
+ */
+constexpr std::uint32_t SERVICE_PROTOCOL_VERSION = 1;
+
+/**
+ * @brief Longest expression source accepted in a request.
+ */
+constexpr std::uint32_t SERVICE_MAX_SOURCE_LENGTH = 1 << 16;
+
+/**
+ * @brief First message of a connection. It carries the shared-memory file
+ * descriptor as SCM_RIGHTS ancillary data; the region holds slots slots of
+ * slot_bytes bytes each. The descriptor must be a memfd sealed with
+ * F_SEAL_SHRINK, otherwise the server closes the connection.
+ */
+struct ServiceHello {
+    std::uint32_t version;
+    std::uint32_t slots;
+    std::uint64_t slot_bytes;
+};
+
+/**
+ * @brief Request header, followed on the socket by source_length bytes of
+ * expression source. The slot holds count records of width doubles
+ * [x0, p_0, ..., p_{width-2}], and the server writes count StreamRecords
+ * directly after them.
+ */
+struct ServiceRequest {
+    std::uint64_t id;
+    std::uint32_t slot;
+    std::uint32_t count;
+    std::uint32_t width;
+    std::uint32_t method;
+    std::int32_t max_iters;
+    std::uint32_t source_length;
+    double tol;
+    std::int64_t max_evaluations;
+};
+
+/**
+ * @brief Response header, followed on the socket by message_length bytes of
+ * error message. An empty message means the results are in the slot.
+ */
+struct ServiceResponse {
+    std::uint64_t id;
+    std::int64_t converged;
+    std::int64_t evaluations;
+    std::uint32_t message_length;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(ServiceHello) == 16, "ServiceHello must match the wire format");
+static_assert(sizeof(ServiceRequest) == 48, "ServiceRequest must match the wire format");
+static_assert(sizeof(ServiceResponse) == 32, "ServiceResponse must match the wire format");
+
+/**
+ * @brief Batch root-solving service listening on a Unix domain socket.
+ *
+ * Each client maps a shared-memory ring of fixed-size slots and passes it to
+ * the server on connection. A request names a slot holding its records and
+ * is split into blocks that run on a persistent thread pool shared by all
+ * clients; results are written back into the slot and a response is sent
+ * when the last block finishes. Requests are read while earlier ones are
+ * still being solved, so a client may keep every slot in flight. Compiled
+ * expressions are cached by source across requests and clients.
+ */
+class SolverServer {
+public:
+    /**
+     * @brief Bind and listen on a Unix domain socket, replacing any stale
+     * socket file at the same path.
+     *
+     * @param socket_path Filesystem path of the socket.
+     * @param num_threads Number of worker threads; 0 uses all hardware
+     * threads.
+     */
+    SolverServer(const std::string& socket_path, int num_threads);
+
+    /**
+     * @brief Stop serving, wait for the connection threads and remove the
+     * socket file.
+     */
+    ~SolverServer();
+
+    SolverServer(const SolverServer&) = delete;
+    SolverServer& operator=(const SolverServer&) = delete;
+
+    /**
+     * @brief Accept and serve connections until stop() is called.
+     */
+    void run();
+
+    /**
+     * @brief Make run() return and close every connection. Safe to call from
+     * any thread.
+     */
+    void stop();
+
+    /**
+     * @brief Number of records solved since the server started.
+     *
+     * @return Record count.
+     */
+    long long records_solved() const;
+
+private:
+    struct Connection;
+    struct Job;
+
+    /**
+     * @brief Receive the hello message, map the client's ring and serve its
+     * requests until the client disconnects.
+     *
+     * @param connection Connection to serve.
+     */
+    void serve(const std::shared_ptr<Connection>& connection);
+
+    /**
+     * @brief Validate a request and submit its blocks to the thread pool.
+     *
+     * @param connection Connection the request arrived on.
+     * @param request Request header.
+     * @param source Expression source.
+     */
+    void dispatch(const std::shared_ptr<Connection>& connection, const ServiceRequest& request, const std::string& source);
+
+    /**
+     * @brief Solve one block of a request on a worker thread, and send the
+     * response once every block has finished.
+     *
+     * @param job Request being solved.
+     * @param block Index of the block.
+     */
+    void solve_block(const std::shared_ptr<Job>& job, long long block);
+
+    /**
+     * @brief Compiled expression for source, compiling and caching it on
+     * first use.
+     *
+     * @param source Expression source.
+     * @return Shared compiled expression.
+     */
+    std::shared_ptr<const CompiledExpression> compile(const std::string& source);
+
+    std::string socket_path_;
+    int listener_ = -1;
+    std::atomic<bool> stopping_{false};
+    std::atomic<long long> records_solved_{0};
+    std::mutex connections_mutex_;
+    std::condition_variable readers_finished_;
+    std::vector<std::weak_ptr<Connection>> connections_;
+    int active_readers_ = 0;
+    std::mutex cache_mutex_;
+    std::unordered_map<std::string, std::shared_ptr<const CompiledExpression>> cache_;
+    ThreadPool pool_;
+};
+
+/**
+ * @brief Client of a SolverServer. Requests are pipelined: submit() returns
+ * as soon as the request is sent, blocking only when every slot of the ring
+ * is in flight, and wait() collects the results of one request. Not
+ * thread-safe; use one client per thread.
+ */
+class SolverClient {
+public:
+    /**
+     * @brief Connect to a server and share a ring of slots with it.
+     *
+     * @param socket_path Filesystem path of the server socket.
+     * @param slots Number of requests that may be in flight.
+     * @param slot_bytes Size of each slot; a request of n records with m
+     * parameters needs n (8 (m + 1) + 16) bytes.
+     */
+    SolverClient(const std::string& socket_path, int slots, std::size_t slot_bytes);
+
+    /**
+     * @brief Close the connection and unmap the ring.
+     */
+    ~SolverClient();
+
+    SolverClient(const SolverClient&) = delete;
+    SolverClient& operator=(const SolverClient&) = delete;
+
+    /**
+     * @brief Send a batch of parametrized problems f(p, x) = 0 to the server.
+     *
+     * @param source Expression source, as accepted by CompiledExpression.
+     * @param x0 Initial approximations, one per problem.
+     * @param params No parameter sets, one shared by every problem, or one
+     * per problem.
+     * @param method Solver applied to each problem.
+     * @param options Per-problem iteration, tolerance and evaluation limits;
+     * the deadline and cancellation token are not sent.
+     * @return Request identifier for wait().
+     */
+    std::uint64_t submit(
+        const std::string& source,
+        const std::vector<double>& x0,
+        const std::vector<std::vector<double>>& params,
+        StreamMethod method,
+        const SolveOptions& options
+    );
+
+    /**
+     * @brief Wait for a submitted request. Throws std::runtime_error with the
+     * server's message if the request failed.
+     *
+     * @param id Identifier returned by submit().
+     * @return One record per problem, in submission order.
+     */
+    std::vector<StreamRecord> wait(std::uint64_t id);
+
+    /**
+     * @brief Submit a batch and wait for its results.
+     *
+     * @param source Expression source, as accepted by CompiledExpression.
+     * @param x0 Initial approximations, one per problem.
+     * @param params No parameter sets, one shared by every problem, or one
+     * per problem.
+     * @param method Solver applied to each problem.
+     * @param options Per-problem iteration, tolerance and evaluation limits.
+     * @return One record per problem, in submission order.
+     */
+    std::vector<StreamRecord> solve(
+        const std::string& source,
+        const std::vector<double>& x0,
+        const std::vector<std::vector<double>>& params,
+        StreamMethod method,
+        const SolveOptions& options
+    );
+
+    /**
+     * @brief Number of submitted requests whose response has not arrived.
+     *
+     * @return Request count.
+     */
+    int in_flight() const;
+
+private:
+    /**
+     * @brief Request whose response has not arrived.
+     */
+    struct Pending {
+        int slot;
+        std::uint32_t count;
+        std::uint32_t width;
+    };
+
+    /**
+     * @brief Request whose response has arrived but was not collected.
+     */
+    struct Completed {
+        std::vector<StreamRecord> records;
+        std::string error;
+    };
+
+    /**
+     * @brief Read one response, copy its results out of the ring and free its
+     * slot.
+     */
+    void receive();
+
+    int socket_ = -1;
+    unsigned char* ring_ = nullptr;
+    std::size_t ring_bytes_ = 0;
+    std::size_t slot_bytes_ = 0;
+    std::uint64_t next_id_ = 1;
+    std::vector<int> free_slots_;
+    std::unordered_map<std::uint64_t, Pending> pending_;
+    std::unordered_map<std::uint64_t, Completed> completed_;
+};
@@ -0,0 +1,201 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "numeric/compiled_expression.hpp"
+#include "numeric/solve_options.hpp"
+
+/**
+ * @brief Solver applied to every record of a stream.
+ */
+enum class StreamMethod {
+    NEWTON,
+    SECANT
+};
+
+/**
+ * @brief Fixed-size output record written for every input record. status
+ * holds the integer value of the record's SolveStatus.
+ */
+struct StreamRecord {
+    double root;
+    std::int32_t status;
+    std::int32_t iterations;
+};
+
+static_assert(sizeof(StreamRecord) == 16, "StreamRecord must be 16 bytes without padding");
+
+/**
+ * @brief Totals over a completed stream.
+ */
+struct StreamStatistics {
+    long long records = 0;
+    long long converged = 0;
+    long long evaluations = 0;
+    long long chunks = 0;
+};
+
+/**
+ * @brief Read-only or read-write memory mapping of a whole file.
+ *
+ * Read-only mappings map an existing file; writable mappings create or
+ * truncate the file to the requested size first. Empty files are not mapped
+ * and report a null data pointer.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map an existing file read-only.
+     *
+     * @param path File path.
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * @brief Create or truncate a file to size bytes and map it read-write.
+     *
+     * @param path File path.
+     * @param size Length of the file in bytes.
+     */
+    MappedFile(const std::string& path, std::size_t size);
+
+    /**
+     * @brief Unmap and close the file.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Start of the mapping.
+     *
+     * @return Pointer to the first byte, or nullptr for an empty file.
+     */
+    unsigned char* data() const;
+
+    /**
+     * @brief Length of the mapping.
+     *
+     * @return Size in bytes.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Ask the kernel to start reading a byte range ahead of use.
+     *
+     * @param offset First byte of the range.
+     * @param length Length of the range in bytes.
+     */
+    void prefetch(std::size_t offset, std::size_t length) const;
+
+    /**
+     * @brief Schedule write-back of a modified byte range without waiting.
+     *
+     * @param offset First byte of the range.
+     * @param length Length of the range in bytes.
+     */
+    void flush_async(std::size_t offset, std::size_t length) const;
+
+    /**
+     * @brief Drop a byte range from the resident set. The file keeps its
+     * contents, and pages are read back if touched again.
+     *
+     * @param offset First byte of the range.
+     * @param length Length of the range in bytes.
+     */
+    void release(std::size_t offset, std::size_t length) const;
+
+    /**
+     * @brief Write every modified page back to the file and wait for it.
+     */
+    void flush() const;
+
+private:
+    /**
+     * @brief Open path and map size bytes of it.
+     *
+     * @param path File path.
+     * @param size Length of the file in bytes.
+     * @param writable Whether to create, truncate and map read-write.
+     */
+    void open(const std::string& path, std::size_t size, bool writable);
+
+    /**
+     * @brief Page-aligned range covering [offset, offset + length), clipped
+     * to the mapping.
+     *
+     * @param offset First byte of the range.
+     * @param length Length of the range in bytes; updated to the aligned
+     * length.
+     * @return Aligned start of the range.
+     */
+    unsigned char* aligned(std::size_t offset, std::size_t& length) const;
+
+    int descriptor_ = -1;
+    unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief Solve f(p, x) = 0 for a contiguous array of records on the calling
+ * thread. This is the kernel shared by solve_stream and the solver service.
+ *
+ * @param func Compiled function of x with parameters p.
+ * @param records count records [x0, p_0, ..., p_{m-1}], where m is
+ * func.parameter_count().
+ * @param count Number of records.
+ * @param results Destination for count output records.
+ * @param method Solver applied to each record. The secant method uses x0 and
+ * x0 + 1e-3 (1 + |x0|) as its initial approximations.
+ * @param options Limits applied to each record. Once the deadline passes or
+ * the token is cancelled, the remaining records are written as
+ * {x0, status, 0} without running the solver.
+ * @return Totals over the records; chunks is left at zero.
+ */
+StreamStatistics solve_records(
+    const CompiledExpression& func,
+    const double* records,
+    long long count,
+    StreamRecord* results,
+    StreamMethod method,
+    const SolveOptions& options
+);
+
+/**
+ * @brief Solve f(p, x) = 0 for every record of a binary file without loading
+ * it into memory.
+ *
+ * The input file is a flat array of native-endian doubles grouped into
+ * records [x0, p_0, ..., p_{m-1}], where m is func.parameter_count(). The
+ * output file is created or truncated to hold one StreamRecord per input
+ * record. Both files are memory-mapped and processed in chunks of
+ * chunk_records records: while a chunk is solved in parallel, the kernel
+ * reads the next input chunk ahead, and finished output chunks are written
+ * back asynchronously and dropped from memory, so the resident set stays
+ * bounded by a few chunks regardless of the file size.
+ *
+ * Iteration, tolerance and evaluation limits of options apply to each
+ * record; the deadline and cancellation token apply to the whole stream. They
+ * are checked before every chunk and record, and once either fires the
+ * remaining records are written as {x0, status, 0} without running the
+ * solver.
+ *
+ * @param func Compiled function of x with parameters p.
+ * @param input_path Path of the parameter file.
+ * @param output_path Path of the result file.
+ * @param method Solver applied to each record, as in solve_records.
+ * @param options Limits applied to each record.
+ * @param chunk_records Records per chunk.
+ * @param num_threads Number of worker threads; 0 uses all hardware threads.
+ * @return Totals over the stream.
+ */
+StreamStatistics solve_stream(
+    const CompiledExpression& func,
+    const std::string& input_path,
+    const std::string& output_path,
+    StreamMethod method,
+    const SolveOptions& options,
+    int chunk_records,
+    int num_threads
+);
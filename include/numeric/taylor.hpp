@@ -0,0 +1,305 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Truncated Taylor series a_0 + a_1 h + ... + a_N h^N about a point x,
+ * where a_k = f^(k)(x) / k!.
+ *
+ * Evaluating f on Taylor<N>::variable(x) yields f(x) and its first N
+ * derivatives in a single evaluation (Taylor-mode automatic differentiation).
+ * Taylor<2> plays the role of a hyper-dual number.
+ *
+ * @tparam N Highest derivative order carried.
+ */
+template <int N>
+class Taylor {
+    static_assert(N >= 0, "Taylor order must be non-negative");
+
+public:
+    std::array<double, N + 1> coefs{};
+
+    /**
+     * @brief Construct the zero series.
+     */
+    Taylor() = default;
+
+    /**
+     * @brief Construct a constant series; allows mixing doubles and Taylor
+     * numbers in arithmetic.
+     *
+     * @param value Constant value.
+     */
+    Taylor(double value){
+        coefs[0] = value;
+    }
+
+    /**
+     * @brief Construct the independent variable x + h at the point x.
+     *
+     * @param x Point of evaluation.
+     * @return Series with value x and unit first derivative.
+     */
+    static Taylor variable(double x){
+        Taylor result{x};
+        if (N >= 1) {
+            result.coefs[1] = 1.0;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Value f(x) of the series.
+     *
+     * @return Zeroth coefficient.
+     */
+    double value() const {
+        return coefs[0];
+    }
+
+    /**
+     * @brief k-th derivative f^(k)(x) of the series.
+     *
+     * @param k Derivative order, 0 <= k <= N.
+     * @return k! a_k.
+     */
+    double derivative(int k) const {
+        if (k < 0 || k > N) {
+            throw std::out_of_range("Taylor derivative order out of range");
+        }
+        double factorial = 1.0;
+        for (int jj = 2; jj <= k; jj++) {
+            factorial *= jj;
+        }
+        return factorial * coefs[k];
+    }
+
+    /**
+     * @brief Negate a series.
+     *
+     * @param a Series.
+     * @return -a.
+     */
+    friend Taylor operator-(const Taylor& a){
+        Taylor result;
+        for (int kk = 0; kk <= N; kk++) {
+            result.coefs[kk] = -a.coefs[kk];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Add two series.
+     *
+     * @param a Left operand.
+     * @param b Right operand.
+     * @return a + b.
+     */
+    friend Taylor operator+(const Taylor& a, const Taylor& b){
+        Taylor result;
+        for (int kk = 0; kk <= N; kk++) {
+            result.coefs[kk] = a.coefs[kk] + b.coefs[kk];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Subtract two series.
+     *
+     * @param a Left operand.
+     * @param b Right operand.
+     * @return a - b.
+     */
+    friend Taylor operator-(const Taylor& a, const Taylor& b){
+        Taylor result;
+        for (int kk = 0; kk <= N; kk++) {
+            result.coefs[kk] = a.coefs[kk] - b.coefs[kk];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Multiply two series (truncated Cauchy product).
+     *
+     * @param a Left operand.
+     * @param b Right operand.
+     * @return a * b.
+     */
+    friend Taylor operator*(const Taylor& a, const Taylor& b){
+        Taylor result;
+        for (int kk = 0; kk <= N; kk++) {
+            double sum = 0.0;
+            for (int jj = 0; jj <= kk; jj++) {
+                sum += a.coefs[jj] * b.coefs[kk - jj];
+            }
+            result.coefs[kk] = sum;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Divide two series.
+     *
+     * @param a Numerator.
+     * @param b Denominator with non-zero value.
+     * @return a / b.
+     */
+    friend Taylor operator/(const Taylor& a, const Taylor& b){
+        Taylor result;
+        for (int kk = 0; kk <= N; kk++) {
+            double sum = a.coefs[kk];
+            for (int jj = 1; jj <= kk; jj++) {
+                sum -= b.coefs[jj] * result.coefs[kk - jj];
+            }
+            result.coefs[kk] = sum / b.coefs[0];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Exponential of a series.
+     *
+     * @param a Series.
+     * @return exp(a).
+     */
+    friend Taylor exp(const Taylor& a){
+        Taylor result;
+        result.coefs[0] = std::exp(a.coefs[0]);
+        for (int kk = 1; kk <= N; kk++) {
+            double sum = 0.0;
+            for (int jj = 1; jj <= kk; jj++) {
+                sum += jj * a.coefs[jj] * result.coefs[kk - jj];
+            }
+            result.coefs[kk] = sum / kk;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Natural logarithm of a series.
+     *
+     * @param a Series with positive value.
+     * @return log(a).
+     */
+    friend Taylor log(const Taylor& a){
+        Taylor result;
+        result.coefs[0] = std::log(a.coefs[0]);
+        for (int kk = 1; kk <= N; kk++) {
+            double sum = 0.0;
+            for (int jj = 1; jj < kk; jj++) {
+                sum += jj * result.coefs[jj] * a.coefs[kk - jj];
+            }
+            result.coefs[kk] = (a.coefs[kk] - sum / kk) / a.coefs[0];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Square root of a series.
+     *
+     * @param a Series with positive value.
+     * @return sqrt(a).
+     */
+    friend Taylor sqrt(const Taylor& a){
+        Taylor result;
+        result.coefs[0] = std::sqrt(a.coefs[0]);
+        for (int kk = 1; kk <= N; kk++) {
+            double sum = 0.0;
+            for (int jj = 1; jj < kk; jj++) {
+                sum += result.coefs[jj] * result.coefs[kk - jj];
+            }
+            result.coefs[kk] = (a.coefs[kk] - sum) / (2 * result.coefs[0]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Sine of a series.
+     *
+     * @param a Series.
+     * @return sin(a).
+     */
+    friend Taylor sin(const Taylor& a){
+        Taylor s, c;
+        sin_cos(a, s, c);
+        return s;
+    }
+
+    /**
+     * @brief Cosine of a series.
+     *
+     * @param a Series.
+     * @return cos(a).
+     */
+    friend Taylor cos(const Taylor& a){
+        Taylor s, c;
+        sin_cos(a, s, c);
+        return c;
+    }
+
+    /**
+     * @brief Raise a series to an integer power by repeated squaring.
+     *
+     * @param a Series.
+     * @param p Integer exponent; negative exponents require a non-zero value.
+     * @return a^p.
+     */
+    friend Taylor pow(const Taylor& a, int p){
+        Taylor base = p < 0 ? Taylor{1.0} / a : a;
+        unsigned int exponent = p < 0 ? -static_cast<unsigned int>(p) : static_cast<unsigned int>(p);
+        Taylor result{1.0};
+        while (exponent > 0) {
+            if (exponent & 1u) {
+                result = result * base;
+            }
+            base = base * base;
+            exponent >>= 1u;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Raise a series to a real power.
+     *
+     * @param a Series with positive value.
+     * @param p Real exponent.
+     * @return a^p.
+     */
+    friend Taylor pow(const Taylor& a, double p){
+        Taylor result;
+        result.coefs[0] = std::pow(a.coefs[0], p);
+        for (int kk = 1; kk <= N; kk++) {
+            double sum = 0.0;
+            for (int jj = 1; jj <= kk; jj++) {
+                sum += (p * jj - (kk - jj)) * a.coefs[jj] * result.coefs[kk - jj];
+            }
+            result.coefs[kk] = sum / (kk * a.coefs[0]);
+        }
+        return result;
+    }
+
+private:
+    /**
+     * @brief Compute sine and cosine of a series together, since their
+     * recurrences depend on each other.
+     *
+     * @param a Series.
+     * @param s Destination for sin(a).
+     * @param c Destination for cos(a).
+     */
+    static void sin_cos(const Taylor& a, Taylor& s, Taylor& c){
+        s.coefs[0] = std::sin(a.coefs[0]);
+        c.coefs[0] = std::cos(a.coefs[0]);
+        for (int kk = 1; kk <= N; kk++) {
+            double sum_s = 0.0;
+            double sum_c = 0.0;
+            for (int jj = 1; jj <= kk; jj++) {
+                sum_s += jj * a.coefs[jj] * c.coefs[kk - jj];
+                sum_c += jj * a.coefs[jj] * s.coefs[kk - jj];
+            }
+            s.coefs[kk] = sum_s / kk;
+            c.coefs[kk] = -sum_c / kk;
+        }
+    }
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed-size pool of worker threads executing queued tasks.
+ *
+ * Tasks may submit further tasks; wait() returns once the queue is empty and
+ * no task is running, which makes the pool suitable for divide-and-conquer
+ * work such as branch-and-bound subdivision.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Start the worker threads.
+     *
+     * @param num_threads Number of workers; values <= 0 select the hardware
+     * concurrency.
+     */
+    explicit ThreadPool(int num_threads);
+
+    /**
+     * @brief Finish queued tasks and join the worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queue a task for execution by a worker.
+     *
+     * @param task Callable run exactly once.
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Block until every submitted task has finished. Rethrows the first
+     * exception raised by a task, if any.
+     */
+    void wait();
+
+    /**
+     * @brief Number of worker threads.
+     *
+     * @return Pool size.
+     */
+    int size() const;
+
+private:
+    /**
+     * @brief Worker loop: pop and run tasks until the pool is stopped.
+     */
+    void worker_loop();
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable task_available_;
+    std::condition_variable tasks_finished_;
+    std::exception_ptr error_;
+    int active_ = 0;
+    bool stopping_ = false;
+};
+
+/**
+ * @brief Run body(ii) for ii in [begin, end) on the pool, splitting the range
+ * into contiguous blocks, and wait for completion.
+ *
+ * @param pool Pool executing the blocks.
+ * @param begin First index.
+ * @param end One past the last index.
+ * @param body Callable invoked once per index; must be thread-safe.
+ */
+void parallel_for(ThreadPool& pool, int begin, int end, const std::function<void(int)>& body);
@@ -0,0 +1,272 @@
+"""Client for the ``numeric-solverd`` batch solving daemon.
+
+The client needs only the standard library and NumPy; the solvers, their
+thread pool and the compiled-expression cache live in the daemon and are
+shared by every process on the host. The wire format matches
+``solver_service.hpp``.
+"""
+
+import array
+import fcntl
+import itertools
+import mmap
+import os
+import socket
+import struct
+
+import numpy as np
+
+PROTOCOL_VERSION = 1
+MAX_SOURCE_LENGTH = 1 << 16
+METHODS = {"newton": 0, "secant": 1}
+
+_HELLO = struct.Struct("=IIQ")
+_REQUEST = struct.Struct("=QIIIIiIdq")
+_RESPONSE = struct.Struct("=QqqII")
+
+RECORD_DTYPE = np.dtype(
+    [("root", "f8"), ("status", "i4"), ("iterations", "i4")]
+)
+
+
+def _shared_memory(size):
+    """Return a file descriptor for an anonymous shared region.
+
+    The region is sealed against shrinking; the daemon refuses to map a
+    ring that the client could truncate under a running solve.
+    """
+    fd = os.memfd_create(
+        "numeric-solver", os.MFD_CLOEXEC | os.MFD_ALLOW_SEALING
+    )
+    try:
+        os.ftruncate(fd, size)
+        fcntl.fcntl(
+            fd, fcntl.F_ADD_SEALS, fcntl.F_SEAL_SHRINK | fcntl.F_SEAL_SEAL
+        )
+    except OSError:
+        os.close(fd)
+        raise
+    return fd
+
+
+class SolverClient:
+    """Pipelined client of a ``numeric-solverd`` daemon.
+
+    Parameters
+    ----------
+    socket_path : str
+        Filesystem path of the daemon socket.
+    slots : int, optional
+        Number of requests that may be in flight.
+    slot_bytes : int, optional
+        Size of each shared-memory slot. A request of n problems with m
+        parameters needs ``n * (8 * (m + 1) + 16)`` bytes.
+
+    Notes
+    -----
+    ``submit`` returns as soon as the request is sent and blocks only when
+    every slot is in flight; ``wait`` collects one request's results. A
+    client is not thread-safe.
+    """
+
+    def __init__(self, socket_path, slots=8, slot_bytes=1 << 20):
+        if slots < 1:
+            raise ValueError("Solver client expects at least one slot")
+        if slot_bytes <= 0 or slot_bytes % 8 != 0:
+            raise ValueError("Slot size must be a positive multiple of 8")
+        self._slot_bytes = slot_bytes
+        self._socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        try:
+            self._socket.connect(socket_path)
+            fd = _shared_memory(slots * slot_bytes)
+            try:
+                self._ring = mmap.mmap(fd, slots * slot_bytes)
+                hello = _HELLO.pack(PROTOCOL_VERSION, slots, slot_bytes)
+                rights = array.array("i", [fd])
+                self._socket.sendmsg(
+                    [hello],
+                    [(socket.SOL_SOCKET, socket.SCM_RIGHTS, rights)],
+                )
+            finally:
+                os.close(fd)
+        except BaseException:
+            self._socket.close()
+            raise
+        self._ids = itertools.count(1)
+        self._free_slots = list(range(slots - 1, -1, -1))
+        self._pending = {}
+        self._completed = {}
+
+    def close(self):
+        """Close the connection and unmap the shared ring."""
+        self._socket.close()
+        self._ring.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc_info):
+        self.close()
+
+    @property
+    def in_flight(self):
+        """Number of submitted requests whose response has not arrived."""
+        return len(self._pending)
+
+    def submit(
+        self,
+        source,
+        x0,
+        params=None,
+        method="newton",
+        max_iters=100,
+        tol=1e-8,
+        max_evaluations=0,
+    ):
+        """Send a batch of problems f(p, x) = 0 and return a request id.
+
+        Parameters
+        ----------
+        source : str
+            Expression in x and p0, p1, ..., as for ``CompiledExpression``.
+        x0 : array_like
+            Initial approximations, one per problem.
+        params : array_like, optional
+            No parameters, one parameter vector shared by every problem, or
+            a 2-D array with one row per problem.
+        method : {"newton", "secant"}, optional
+            Solver applied to each problem.
+        max_iters : int, optional
+            Maximum number of iterations per problem.
+        tol : float, optional
+            Convergence tolerance.
+        max_evaluations : int, optional
+            Function-evaluation budget per problem; 0 means unlimited.
+
+        Returns
+        -------
+        int
+            Identifier to pass to ``wait``.
+        """
+        x0 = np.ascontiguousarray(x0, dtype=np.float64).reshape(-1)
+        count = x0.size
+        if params is None:
+            params = np.empty((count, 0))
+        params = np.asarray(params, dtype=np.float64)
+        if params.ndim == 1:
+            params = np.broadcast_to(params, (count, params.size))
+        if params.ndim != 2 or params.shape[0] != count:
+            raise ValueError(
+                "Batch expects no parameter sets, one, or one per initial "
+                "approximation"
+            )
+        width = params.shape[1] + 1
+        encoded = source.encode()
+        if len(encoded) > MAX_SOURCE_LENGTH:
+            raise ValueError("Expression source is too long")
+        needed = count * (8 * width + RECORD_DTYPE.itemsize)
+        if needed > self._slot_bytes:
+            raise ValueError(
+                f"Request of {needed} bytes does not fit a slot of "
+                f"{self._slot_bytes} bytes"
+            )
+
+        while not self._free_slots:
+            self._receive()
+        slot = self._free_slots.pop()
+        records = np.ndarray(
+            (count, width),
+            dtype=np.float64,
+            buffer=self._ring,
+            offset=slot * self._slot_bytes,
+        )
+        records[:, 0] = x0
+        records[:, 1:] = params
+
+        request_id = next(self._ids)
+        header = _REQUEST.pack(
+            request_id,
+            slot,
+            count,
+            width,
+            METHODS[method],
+            max_iters,
+            len(encoded),
+            tol,
+            max_evaluations,
+        )
+        self._socket.sendall(header + encoded)
+        self._pending[request_id] = (slot, count, width)
+        return request_id
+
+    def wait(self, request_id):
+        """Wait for a submitted request.
+
+        Parameters
+        ----------
+        request_id : int
+            Identifier returned by ``submit``.
+
+        Returns
+        -------
+        numpy.ndarray
+            Structured array of ``root``, ``status`` and ``iterations``, one
+            entry per problem; ``status`` holds ``SolveStatus`` values.
+        """
+        known = request_id in self._pending or request_id in self._completed
+        if not known:
+            raise KeyError(f"Unknown or collected request {request_id}")
+        while request_id not in self._completed:
+            self._receive()
+        records, error = self._completed.pop(request_id)
+        if error:
+            raise RuntimeError(error)
+        return records
+
+    def solve(self, source, x0, params=None, **kwargs):
+        """Submit a batch and wait for its results; see ``submit``.
+
+        Parameters
+        ----------
+        source : str
+            Expression in x and p0, p1, ....
+        x0 : array_like
+            Initial approximations, one per problem.
+        params : array_like, optional
+            Parameters as for ``submit``.
+        **kwargs
+            Further arguments of ``submit``.
+
+        Returns
+        -------
+        numpy.ndarray
+            Structured array as returned by ``wait``.
+        """
+        return self.wait(self.submit(source, x0, params, **kwargs))
+
+    def _recv_exactly(self, length):
+        """Read exactly ``length`` bytes from the daemon."""
+        data = bytearray()
+        while len(data) < length:
+            chunk = self._socket.recv(length - len(data))
+            if not chunk:
+                raise ConnectionError("Solver service closed the connection")
+            data += chunk
+        return bytes(data)
+
+    def _receive(self):
+        """Read one response and copy its results out of the ring."""
+        response = self._recv_exactly(_RESPONSE.size)
+        request_id, _, _, message_length, _ = _RESPONSE.unpack(response)
+        error = self._recv_exactly(message_length).decode()
+        slot, count, width = self._pending.pop(request_id)
+        records = None
+        if not error:
+            records = np.ndarray(
+                (count,),
+                dtype=RECORD_DTYPE,
+                buffer=self._ring,
+                offset=slot * self._slot_bytes + 8 * count * width,
+            ).copy()
+        self._free_slots.append(slot)
+        self._completed[request_id] = (records, error)
@@ -0,0 +1,86 @@
+#!/usr/bin/env bash
+# Build a profile-guided, link-time optimized wheel.
+#
+# 1. Build an instrumented wheel (NUMERIC_PGO=GENERATE).
+# 2. Install it into a scratch directory and run the benchmark suite on it
+#    to record profiles.
+# 3. Rebuild in the same build directory with NUMERIC_PGO=USE and write
+#    the wheel to dist/.
+#
+# GCC names profiles after the object files, so both builds must share one
+# build directory. The benchmark suite needs the "bench" extra installed.
+set -euo pipefail
+
+repo_root="$(git rev-parse --show-toplevel)"
+python="${PYTHON:-python3}"
+build_dir="$repo_root/build/pgo"
+profile_dir="$build_dir/profiles"
+stage_dir="$build_dir/stage"
+dist_dir="$repo_root/dist"
+training_rounds="${PGO_TRAINING_ROUNDS:-50}"
+
+if ! "$python" -c "import scipy" >/dev/null 2>&1; then
+  echo "The training run needs scipy; install with: pip install -e \".[bench]\"" >&2
+  exit 1
+fi
+
+build_wheel() {
+  local phase="$1"
+  local output="$2"
+  "$python" -m pip wheel "$repo_root" \
+    --no-deps \
+    --wheel-dir "$output" \
+    -C "build-dir=$build_dir/cmake" \
+    -C "cmake.build-type=Release" \
+    -C "cmake.define.NUMERIC_ENABLE_IPO=ON" \
+    -C "cmake.define.NUMERIC_PGO=$phase" \
+    -C "cmake.define.NUMERIC_PGO_DIR=$profile_dir"
+}
+
+rm -rf "$profile_dir" "$stage_dir"
+mkdir -p "$profile_dir"
+
+# Instrumented build and training run. pythonpath is cleared so the
+# installed extension modules are imported instead of python/numeric, and
+# addopts is cleared so coverage does not need pytest-cov or distort the
+# profile.
+build_wheel GENERATE "$stage_dir/wheel"
+"$python" -m pip install --no-deps --target "$stage_dir/site" "$stage_dir"/wheel/numeric-*.whl
+(
+  cd "$repo_root"
+  export PYTHONPATH="$stage_dir/site"
+  "$python" - "$stage_dir/site" <<'PY'
+import os
+import sys
+
+import numeric.root_approximation
+
+site = os.path.realpath(sys.argv[1])
+module = os.path.realpath(numeric.root_approximation.__file__)
+if os.path.commonpath([site, module]) != site:
+    sys.exit(f"Training would import {module}, not the wheel in {site}")
+PY
+  "$python" -m pytest benchmarks \
+    -q \
+    -p no:cacheprovider \
+    -o addopts= \
+    -o pythonpath= \
+    --benchmark-min-rounds="$training_rounds"
+)
+
+# USE builds pass -Wno-missing-profile, so an empty profile directory would
+# silently produce an unoptimized wheel.
+if [[ -z "$(find "$profile_dir" -type f \( -name '*.gcda' -o -name '*.profraw' \) -print -quit)" ]]; then
+  echo "The training run wrote no profiles to $profile_dir" >&2
+  exit 1
+fi
+
+# Clang writes raw profiles that must be merged before use.
+shopt -s nullglob
+raw_profiles=("$profile_dir"/*.profraw)
+if (( ${#raw_profiles[@]} > 0 )); then
+  llvm-profdata merge --output="$profile_dir/numeric.profdata" "${raw_profiles[@]}"
+fi
+
+build_wheel USE "$dist_dir"
+echo "Profile-guided wheel written to $dist_dir"
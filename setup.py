@@ -23,6 +23,11 @@ setup(
             "isort",
             "flake8",
             "pre-commit",
-        ]
+        ],
+        "bench": [
+            "pytest>=6.0",
+            "pytest-benchmark",
+            "scipy",
+        ],
     },
 )
@@ -0,0 +1,180 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/complex.h>
+#include <pybind11/functional.h>
+#include <pybind11/stl.h>
+
+#include <vector>
+
+#include "numeric/differentiation.hpp"
+
+namespace py = pybind11;
+
+/**
+ * @brief Define Python bindings for numerical differentiation algorithms.
+ *
+ * Exposes the C++ implementations as `numeric.differentiation`.
+ */
+PYBIND11_MODULE(differentiation, m) {
+    m.doc() = "Numerical differentiation algorithms using std::function";
+
+    /**
+     * @brief Bind the optimal step size heuristic to Python.
+     */
+    m.def(
+        "optimal_step",
+        &optimal_step,
+        R"pbdoc(
+optimal_step(x, order=2)
+
+Step size balancing truncation and rounding error for a centered difference.
+
+Parameters
+----------
+x : float
+order : int, optional
+
+Returns
+-------
+float
+)pbdoc",
+        py::arg("x"),
+        py::arg("order") = 2
+    );
+
+    /**
+     * @brief Bind the complex-step derivative to Python.
+     */
+    m.def(
+        "complex_step_derivative",
+        &complex_step_derivative,
+        R"pbdoc(
+complex_step_derivative(func, x, h=1e-20)
+
+Approximate f'(x) as Im(f(x + ih)) / h; accurate to machine precision.
+
+Parameters
+----------
+func : Callable[[complex], complex]
+    Analytic function, e.g. written with ``cmath``.
+x : float
+h : float, optional
+
+Returns
+-------
+float
+)pbdoc",
+        py::arg("func"),
+        py::arg("x"),
+        py::arg("h") = 1e-20
+    );
+
+    /**
+     * @brief Bind the centered difference stencils to Python.
+     */
+    m.def(
+        "centered_difference",
+        &centered_difference,
+        R"pbdoc(
+centered_difference(func, x, h, order=4)
+
+Approximate f'(x) using a centered difference stencil of order 2, 4 or 6.
+
+Parameters
+----------
+func : Callable[[float], float]
+x : float
+h : float
+order : int, optional
+
+Returns
+-------
+float
+)pbdoc",
+        py::arg("func"),
+        py::arg("x"),
+        py::arg("h"),
+        py::arg("order") = 4
+    );
+
+    /**
+     * @brief Bind the Richardson extrapolated derivative to Python.
+     */
+    m.def(
+        "richardson_derivative",
+        &richardson_derivative,
+        R"pbdoc(
+richardson_derivative(func, x, h=0.1, max_levels=10, tol=1e-12)
+
+Approximate f'(x) by Richardson extrapolation with automatic step selection.
+
+Parameters
+----------
+func : Callable[[float], float]
+x : float
+h : float, optional
+max_levels : int, optional
+tol : float, optional
+
+Returns
+-------
+float
+)pbdoc",
+        py::arg("func"),
+        py::arg("x"),
+        py::arg("h") = 0.1,
+        py::arg("max_levels") = 10,
+        py::arg("tol") = 1e-12
+    );
+
+    /**
+     * @brief Bind the batched centered difference to Python.
+     */
+    m.def(
+        "centered_difference_batch",
+        &centered_difference_batch,
+        R"pbdoc(
+centered_difference_batch(func, x, order=4)
+
+Approximate f' at every point of x with optimally sized centered differences.
+
+Parameters
+----------
+func : Callable[[float], float]
+x : Sequence[float]
+order : int, optional
+
+Returns
+-------
+list[float]
+)pbdoc",
+        py::arg("func"),
+        py::arg("x"),
+        py::arg("order") = 4
+    );
+
+    /**
+     * @brief Bind the batched complex-step derivative to Python.
+     */
+    m.def(
+        "complex_step_derivative_batch",
+        &complex_step_derivative_batch,
+        R"pbdoc(
+complex_step_derivative_batch(func, x, h=1e-20)
+
+Approximate f' at every point of x with the complex-step formula.
+
+Parameters
+----------
+func : Callable[[complex], complex]
+x : Sequence[float]
+h : float, optional
+
+Returns
+-------
+list[float]
+)pbdoc",
+        py::arg("func"),
+        py::arg("x"),
+        py::arg("h") = 1e-20
+    );
+}
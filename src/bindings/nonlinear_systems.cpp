@@ -0,0 +1,108 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/functional.h>
+#include <pybind11/stl.h>
+
+#include <vector>
+
+#include "numeric/nonlinear_systems.hpp"
+
+namespace py = pybind11;
+
+/**
+ * @brief Define Python bindings for nonlinear system algorithms.
+ *
+ * Exposes the C++ implementations as `numeric.nonlinear_systems`.
+ */
+PYBIND11_MODULE(nonlinear_systems, m) {
+    m.doc() = "Nonlinear system algorithms using std::function";
+
+    /**
+     * @brief Bind the finite difference Jacobian approximation to Python.
+     */
+    m.def(
+        "finite_difference_jacobian",
+        &finite_difference_jacobian,
+        R"pbdoc(
+finite_difference_jacobian(func, x, epsilon=1e-3)
+
+Approximate the Jacobian of F at x using centered finite differences.
+
+Parameters
+----------
+func : Callable[[list[float]], list[float]]
+x : Sequence[float]
+epsilon : float, optional
+
+Returns
+-------
+list[float]
+    Row-major n x n Jacobian with entries dF_i / dx_j.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x"),
+        py::arg("epsilon") = 1e-3
+    );
+
+    /**
+     * @brief Bind Broyden's method to Python.
+     */
+    m.def(
+        "broyden_method",
+        py::overload_cast<
+            const std::function<std::vector<double>(const std::vector<double>&)>&,
+            std::vector<double>,
+            int,
+            double
+        >(&broyden_method),
+        R"pbdoc(
+broyden_method(func, x0, max_iters=100, tol=1e-8)
+
+Approximate a solution of F(x) = 0 using Broyden's quasi-Newton method.
+
+Parameters
+----------
+func : Callable[[list[float]], list[float]]
+x0 : Sequence[float]
+max_iters : int, optional
+tol : float, optional
+
+Returns
+-------
+list[float]
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8
+    );
+
+    /**
+     * @brief Bind the batched Broyden's method to Python.
+     */
+    m.def(
+        "broyden_method_batch",
+        &broyden_method_batch,
+        R"pbdoc(
+broyden_method_batch(func, x0, max_iters=100, tol=1e-8)
+
+Solve many independent systems F_k(x) = 0 with Broyden's method.
+
+Parameters
+----------
+func : Callable[[int, list[float]], list[float]]
+    Evaluates system k at x.
+x0 : Sequence[Sequence[float]]
+    Initial approximations, one per system.
+max_iters : int, optional
+tol : float, optional
+
+Returns
+-------
+list[list[float]]
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8
+    );
+}
@@ -1,14 +1,143 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/functional.h>
+#include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
+#include <optional>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <tuple>
 #include <vector>
 
+#include "numeric/compiled_expression.hpp"
+#include "numeric/interval.hpp"
+#include "numeric/inverse_table.hpp"
+#include "numeric/lane_batch.hpp"
 #include "numeric/root_approximation.hpp"
+#include "numeric/solution_cache.hpp"
+#include "numeric/streaming.hpp"
+#include "numeric/taylor.hpp"
 
 namespace py = pybind11;
 
+/**
+ * @brief Bind Taylor<N> to Python with arithmetic operators and elementary
+ * functions, so ordinary Python lambdas can be evaluated on Taylor numbers.
+ *
+ * @tparam N Highest derivative order carried.
+ * @param m Module receiving the class.
+ * @param name Python class name.
+ */
+template <int N> void bind_taylor(py::module_& m, const char* name){
+    py::class_<Taylor<N>>(m, name, R"pbdoc(
+Truncated Taylor series carrying a value and its first N derivatives.
+
+Construct the independent variable with ``variable(x)``; arithmetic,
+``**`` and the methods ``exp``, ``log``, ``sqrt``, ``sin`` and ``cos``
+(also reachable through the NumPy ufuncs of the same name) propagate
+derivatives exactly.
+)pbdoc")
+        .def(py::init<double>(), py::arg("value") = 0.0)
+        .def_static("variable", &Taylor<N>::variable, py::arg("x"))
+        .def("value", &Taylor<N>::value)
+        .def("derivative", &Taylor<N>::derivative, py::arg("k"))
+        .def(-py::self)
+        .def(py::self + py::self)
+        .def(py::self + double())
+        .def(double() + py::self)
+        .def(py::self - py::self)
+        .def(py::self - double())
+        .def(double() - py::self)
+        .def(py::self * py::self)
+        .def(py::self * double())
+        .def(double() * py::self)
+        .def(py::self / py::self)
+        .def(py::self / double())
+        .def(double() / py::self)
+        .def("__pow__", [](const Taylor<N>& a, int p) { return pow(a, p); }, py::is_operator())
+        .def("__pow__", [](const Taylor<N>& a, double p) { return pow(a, p); }, py::is_operator())
+        .def("exp", [](const Taylor<N>& a) { return exp(a); })
+        .def("log", [](const Taylor<N>& a) { return log(a); })
+        .def("sqrt", [](const Taylor<N>& a) { return sqrt(a); })
+        .def("sin", [](const Taylor<N>& a) { return sin(a); })
+        .def("cos", [](const Taylor<N>& a) { return cos(a); })
+        .def("__repr__", [name](const Taylor<N>& a) {
+            std::ostringstream out;
+            out << name << "(";
+            for (int kk = 0; kk <= N; kk++) {
+                out << (kk == 0 ? "" : ", ") << a.derivative(kk);
+            }
+            out << ")";
+            return out.str();
+        });
+
+    py::implicitly_convertible<double, Taylor<N>>();
+}
+
+/**
+ * @brief Run Householder's method of order N on a Python callable.
+ *
+ * @tparam N Order of the method.
+ * @param func Python callable accepting and returning TaylorN numbers.
+ * @param x0 Initial approximation.
+ * @param max_iters Maximum number of iterations.
+ * @param tol Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0.
+ */
+template <int N> double householder_python(const py::function& func, double x0, int max_iters, double tol){
+    const std::function<Taylor<N>(const Taylor<N>&)> function = [&func](const Taylor<N>& x) {
+        return func(x).template cast<Taylor<N>>();
+    };
+    return householder_method<N>(function, x0, max_iters, tol);
+}
+
+/**
+ * @brief Run Householder's method of order N on a Python callable under solve
+ * options, releasing the GIL between evaluations so the solve can be
+ * cancelled from another Python thread.
+ *
+ * @tparam N Order of the method.
+ * @param func Python callable accepting and returning TaylorN numbers.
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result.
+ */
+template <int N> SolveResult householder_options_python(const py::function& func, double x0, const SolveOptions& options){
+    const std::function<Taylor<N>(const Taylor<N>&)> function = [&func](const Taylor<N>& x) {
+        py::gil_scoped_acquire acquire;
+        return func(x).template cast<Taylor<N>>();
+    };
+    py::gil_scoped_release release;
+    return householder_method<N>(function, x0, options);
+}
+
+/**
+ * @brief Request a one-dimensional, contiguous float64 view of a Python
+ * buffer without copying it.
+ *
+ * @param buffer Object supporting the buffer protocol.
+ * @param name Argument name used in error messages.
+ * @param writable Whether the view will be written to.
+ * @return Buffer view; it keeps the underlying object alive.
+ */
+py::buffer_info float64_vector(const py::buffer& buffer, const std::string& name, bool writable){
+    py::buffer_info info = buffer.request();
+    if (info.format != py::format_descriptor<double>::format() || info.itemsize != sizeof(double)) {
+        throw std::invalid_argument(name + " must hold float64 values");
+    }
+    if (info.ndim != 1) {
+        throw std::invalid_argument(name + " must be one-dimensional");
+    }
+    if (info.shape[0] > 1 && info.strides[0] != static_cast<py::ssize_t>(sizeof(double))) {
+        throw std::invalid_argument(name + " must be contiguous");
+    }
+    if (writable && info.readonly) {
+        throw std::invalid_argument(name + " must be writeable");
+    }
+    return info;
+}
+
 /**
  * @brief Define Python bindings for root approximation algorithms.
  *
@@ -18,6 +147,420 @@ namespace py = pybind11;
 PYBIND11_MODULE(root_approximation, m) {
     m.doc() = "Root approximation algorithms using std::function";
 
+    bind_taylor<1>(m, "Taylor1");
+    bind_taylor<2>(m, "Taylor2");
+    bind_taylor<3>(m, "Taylor3");
+    bind_taylor<4>(m, "Taylor4");
+
+    /**
+     * @brief Bind the outward-rounded Interval type to Python.
+     */
+    py::class_<Interval>(m, "Interval", R"pbdoc(
+Closed interval [lower, upper] with outward-rounded arithmetic.
+
+Arithmetic, integer ``**`` and the methods ``exp``, ``log``, ``sqrt``,
+``sin`` and ``cos`` return guaranteed enclosures of the exact result.
+)pbdoc")
+        .def(py::init<double>(), py::arg("value"))
+        .def(py::init<double, double>(), py::arg("lower"), py::arg("upper"))
+        .def_readonly("lower", &Interval::lower)
+        .def_readonly("upper", &Interval::upper)
+        .def("midpoint", &Interval::midpoint)
+        .def("width", &Interval::width)
+        .def("contains", &Interval::contains, py::arg("x"))
+        .def(-py::self)
+        .def(py::self + py::self)
+        .def(py::self + double())
+        .def(double() + py::self)
+        .def(py::self - py::self)
+        .def(py::self - double())
+        .def(double() - py::self)
+        .def(py::self * py::self)
+        .def(py::self * double())
+        .def(double() * py::self)
+        .def(py::self / py::self)
+        .def(py::self / double())
+        .def(double() / py::self)
+        .def("__pow__", [](const Interval& a, int p) { return pow(a, p); }, py::is_operator())
+        .def("exp", [](const Interval& a) { return exp(a); })
+        .def("log", [](const Interval& a) { return log(a); })
+        .def("sqrt", [](const Interval& a) { return sqrt(a); })
+        .def("sin", [](const Interval& a) { return sin(a); })
+        .def("cos", [](const Interval& a) { return cos(a); })
+        .def("__repr__", [](const Interval& a) {
+            std::ostringstream out;
+            out.precision(17);
+            out << "Interval(" << a.lower << ", " << a.upper << ")";
+            return out.str();
+        });
+
+    py::implicitly_convertible<double, Interval>();
+
+    /**
+     * @brief Bind the verified root enclosure record to Python.
+     */
+    py::class_<RootEnclosure>(m, "RootEnclosure", "Verified enclosure of a root.")
+        .def_readonly("enclosure", &RootEnclosure::enclosure)
+        .def_readonly("unique", &RootEnclosure::unique);
+
+    /**
+     * @brief Bind the precomputed inverse-function table to Python.
+     */
+    py::class_<InverseTable>(m, "InverseTable", R"pbdoc(
+Piecewise-Chebyshev table of x = f^-1(y) for a strictly monotone f on [a, b].
+
+f(x) = y is solved once at the Chebyshev points of an adaptive partition of
+the range of f, in parallel; queries cost a binary search and a Clenshaw
+evaluation.
+
+Parameters
+----------
+func : Callable[[float], float]
+    Continuous, strictly monotone function.
+a, b : float
+    Domain of f.
+degree : int, optional
+    Chebyshev degree of every piece.
+tol : float, optional
+    Absolute tolerance on x.
+num_threads : int, optional
+    Worker threads used while building; 0 uses all cores.
+)pbdoc")
+        .def(
+            py::init<const std::function<double(double)>&, double, double, int, double, int>(),
+            py::arg("func"),
+            py::arg("a"),
+            py::arg("b"),
+            py::arg("degree") = 8,
+            py::arg("tol") = 1e-12,
+            py::arg("num_threads") = 0,
+            py::call_guard<py::gil_scoped_release>()
+        )
+        .def(
+            "evaluate",
+            py::overload_cast<double, bool>(&InverseTable::evaluate, py::const_),
+            R"pbdoc(
+evaluate(y, polish=False)
+
+Approximate the preimage of y under f.
+
+Parameters
+----------
+y : float
+    Value in [lower, upper].
+polish : bool, optional
+    Apply one Newton step, costing one evaluation of f.
+
+Returns
+-------
+float
+    Approximate inverse at y.
+)pbdoc",
+            py::arg("y"),
+            py::arg("polish") = false
+        )
+        .def(
+            "evaluate",
+            py::overload_cast<const std::vector<double>&, bool>(&InverseTable::evaluate, py::const_),
+            py::arg("y"),
+            py::arg("polish") = false,
+            py::call_guard<py::gil_scoped_release>()
+        )
+        .def("__call__", [](const InverseTable& table, double y) { return table.evaluate(y, false); })
+        .def_property_readonly("pieces", &InverseTable::pieces)
+        .def_property_readonly("lower", &InverseTable::lower)
+        .def_property_readonly("upper", &InverseTable::upper);
+
+    /**
+     * @brief Bind the warm-starting solution cache to Python.
+     */
+    py::class_<SolutionCache>(m, "SolutionCache", R"pbdoc(
+Bounded LRU cache of roots of parametrized problems, keyed by parameters.
+
+Exact parameter matches return the cached root directly; otherwise the
+nearest cached root within about one grid cell warm-starts the solver.
+
+Parameters
+----------
+dimension : int
+    Length of every parameter vector.
+cell_size : float, optional
+    Side of a grid cell.
+capacity : int, optional
+    Maximum number of stored roots.
+)pbdoc")
+        .def(py::init<int, double, int>(), py::arg("dimension"), py::arg("cell_size") = 1e-2, py::arg("capacity") = 1024)
+        .def(
+            "newton_method",
+            py::overload_cast<const std::function<double(const std::vector<double>&, double)>&, const std::vector<double>&, double, int, double>(&SolutionCache::newton_method),
+            R"pbdoc(
+newton_method(func, params, x0, max_iters=100, tol=1e-10)
+
+Newton-Raphson solve of func(params, x) = 0 with cache lookup.
+
+Parameters
+----------
+func : Callable[[list[float], float], float]
+params : list[float]
+x0 : float
+    Initial approximation used on a cache miss.
+max_iters : int, optional
+tol : float, optional
+
+Returns
+-------
+float
+    Approximate root.
+)pbdoc",
+            py::arg("func"),
+            py::arg("params"),
+            py::arg("x0"),
+            py::arg("max_iters") = 100,
+            py::arg("tol") = 1e-10
+        )
+        .def(
+            "secant_method",
+            py::overload_cast<const std::function<double(const std::vector<double>&, double)>&, const std::vector<double>&, double, double, int, double>(&SolutionCache::secant_method),
+            R"pbdoc(
+secant_method(func, params, x0, x1, max_iters=100, tol=1e-10)
+
+Secant solve of func(params, x) = 0 with cache lookup.
+
+Parameters
+----------
+func : Callable[[list[float], float], float]
+params : list[float]
+x0, x1 : float
+    Initial approximations used on a cache miss.
+max_iters : int, optional
+tol : float, optional
+
+Returns
+-------
+float
+    Approximate root.
+)pbdoc",
+            py::arg("func"),
+            py::arg("params"),
+            py::arg("x0"),
+            py::arg("x1"),
+            py::arg("max_iters") = 100,
+            py::arg("tol") = 1e-10
+        )
+        .def(
+            "newton_method",
+            py::overload_cast<const std::function<double(const std::vector<double>&, double)>&, const std::vector<double>&, double, const SolveOptions&>(&SolutionCache::newton_method),
+            R"pbdoc(
+newton_method(func, params, x0, options)
+
+Newton-Raphson solve of func(params, x) = 0 with cache lookup, under solve
+limits. An exact hit reports CONVERGED with no evaluations.
+
+Parameters
+----------
+func : Callable[[list[float], float], float]
+params : list[float]
+x0 : float
+    Initial approximation used on a cache miss.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+            py::arg("func"),
+            py::arg("params"),
+            py::arg("x0"),
+            py::arg("options"),
+            py::call_guard<py::gil_scoped_release>()
+        )
+        .def(
+            "secant_method",
+            py::overload_cast<const std::function<double(const std::vector<double>&, double)>&, const std::vector<double>&, double, double, const SolveOptions&>(&SolutionCache::secant_method),
+            R"pbdoc(
+secant_method(func, params, x0, x1, options)
+
+Secant solve of func(params, x) = 0 with cache lookup, under solve limits.
+An exact hit reports CONVERGED with no evaluations.
+
+Parameters
+----------
+func : Callable[[list[float], float], float]
+params : list[float]
+x0, x1 : float
+    Initial approximations used on a cache miss.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+            py::arg("func"),
+            py::arg("params"),
+            py::arg("x0"),
+            py::arg("x1"),
+            py::arg("options"),
+            py::call_guard<py::gil_scoped_release>()
+        )
+        .def("insert", &SolutionCache::insert, py::arg("params"), py::arg("root"))
+        .def("clear", &SolutionCache::clear)
+        .def("__len__", &SolutionCache::size)
+        .def_property_readonly("hits", &SolutionCache::hits)
+        .def_property_readonly("warm_starts", &SolutionCache::warm_starts)
+        .def_property_readonly("misses", &SolutionCache::misses)
+        .def_property_readonly("hit_rate", &SolutionCache::hit_rate);
+
+    /**
+     * @brief Bind the runtime expression compiler to Python.
+     */
+    py::class_<CompiledExpression>(m, "CompiledExpression", R"pbdoc(
+Expression string compiled once into native register bytecode.
+
+Supports numbers, ``x``, parameters ``p0`` to ``p1023``, ``pi``, ``e``,
+``+ - * /``, ``**`` (or ``^``), parentheses and ``exp``, ``log``, ``sqrt``,
+``sin``, ``cos`` and ``tan``. Passing a CompiledExpression (or a plain
+string) to ``bisection``, ``newton_method``, ``secant_method`` or
+``newton_method_batch`` runs the whole solve in C++ without calling back into
+Python; Newton's method takes f' from the derivative tape.
+
+Parameters
+----------
+source : str
+    Expression text, e.g. ``"x**3 + 4*x**2 - 10"``.
+)pbdoc")
+        .def(py::init<const std::string&>(), py::arg("source"))
+        .def(
+            "__call__",
+            &CompiledExpression::evaluate,
+            py::arg("x"),
+            py::arg("params") = std::vector<double>{}
+        )
+        .def(
+            "evaluate",
+            [](const CompiledExpression& func, const std::vector<double>& xs, const std::vector<double>& params) {
+                std::vector<double> values;
+                values.reserve(xs.size());
+                for (double x : xs) {
+                    values.push_back(func.evaluate(x, params));
+                }
+                return values;
+            },
+            py::arg("xs"),
+            py::arg("params") = std::vector<double>{},
+            py::call_guard<py::gil_scoped_release>()
+        )
+        .def(
+            "derivative",
+            &CompiledExpression::evaluate_derivative,
+            py::arg("x"),
+            py::arg("params") = std::vector<double>{}
+        )
+        .def_property_readonly("source", &CompiledExpression::source)
+        .def_property_readonly("parameter_count", &CompiledExpression::parameter_count)
+        .def_property_readonly("register_count", &CompiledExpression::register_count)
+        .def("__repr__", [](const CompiledExpression& func) {
+            return "CompiledExpression('" + func.source() + "')";
+        });
+
+    py::implicitly_convertible<std::string, CompiledExpression>();
+
+    /**
+     * @brief Bind bisection on a compiled expression; registered before the
+     * callable overload so expressions never round-trip through Python.
+     */
+    m.def(
+        "bisection",
+        [](const CompiledExpression& func, double a, double b, int max_iters, double tol, const std::vector<double>& params) {
+            return bisection([&func, &params](double x) { return func.evaluate(x, params); }, a, b, max_iters, tol);
+        },
+        py::arg("func"),
+        py::arg("a"),
+        py::arg("b"),
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8,
+        py::arg("params") = std::vector<double>{},
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    /**
+     * @brief Bind Newton's method on a compiled expression, with f' taken from
+     * the derivative tape.
+     */
+    m.def(
+        "newton_method",
+        [](const CompiledExpression& func, double x0, int max_iters, double tol, const std::vector<double>& params) {
+            const std::function<std::tuple<double, double>(double)> f_df = [&func, &params](double x) {
+                return func.evaluate_derivative(x, params);
+            };
+            return newton_method(f_df, x0, max_iters, tol);
+        },
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8,
+        py::arg("params") = std::vector<double>{},
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    /**
+     * @brief Bind the secant method on a compiled expression.
+     */
+    m.def(
+        "secant_method",
+        [](const CompiledExpression& func, double x0, double x1, int max_iters, double tol, const std::vector<double>& params) {
+            return secant_method([&func, &params](double x) { return func.evaluate(x, params); }, x0, x1, max_iters, tol);
+        },
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("x1"),
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8,
+        py::arg("params") = std::vector<double>{},
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    /**
+     * @brief Bind the batched Newton solver for compiled expressions.
+     */
+    m.def(
+        "newton_method_batch",
+        py::overload_cast<const CompiledExpression&, const std::vector<double>&, const std::vector<std::vector<double>>&, int, double, int>(&newton_method_batch),
+        R"pbdoc(
+newton_method_batch(func, x0, params=[], max_iters=100, tol=1e-8, num_threads=0)
+
+Parallel Newton solves of one compiled expression over many parameter
+sets, run entirely in C++ with the GIL released.
+
+Parameters
+----------
+func : CompiledExpression or str
+x0 : list[float]
+    Initial approximations, one per solve.
+params : list[list[float]], optional
+    No parameter sets, one shared set, or one set per solve.
+max_iters : int, optional
+tol : float, optional
+num_threads : int, optional
+    Worker threads; 0 uses all cores.
+
+Returns
+-------
+list[float]
+    Approximate roots, one per solve.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("params") = std::vector<std::vector<double>>{},
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8,
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>()
+    );
+
     /**
      * @brief Bind the bisection function to Python.
      */
@@ -106,7 +649,7 @@ float
      */
     m.def(
         "newton_method",
-        &newton_method,
+        static_cast<double (*)(const std::function<double(double)>&, double, int, double)>(&newton_method),
         R"pbdoc(
 newton_method(func, x0, max_iters=100, tol=1e-8)
 
@@ -129,6 +672,80 @@ float
         py::arg("tol") = 1e-8
     );
 
+    /**
+     * @brief Bind Halley's root approximation function to Python.
+     */
+    m.def(
+        "halley_method",
+        static_cast<double (*)(const std::function<Taylor<2>(const Taylor<2>&)>&, double, int, double)>(&halley_method),
+        R"pbdoc(
+halley_method(func, x0, max_iters=100, tol=1e-8)
+
+Approximate a root using Halley's method from x0. func is called once per
+iteration with a Taylor2 number, which yields f, f' and f'' together.
+
+Parameters
+----------
+func : Callable[[Taylor2], Taylor2]
+x0 : float
+max_iters : int, optional
+tol : float, optional
+
+Returns
+-------
+float
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8
+    );
+
+    /**
+     * @brief Bind Householder's root approximation function to Python.
+     */
+    m.def(
+        "householder_method",
+        [](const py::function& func, double x0, int order, int max_iters, double tol) {
+            switch (order) {
+                case 1:
+                    return householder_python<1>(func, x0, max_iters, tol);
+                case 2:
+                    return householder_python<2>(func, x0, max_iters, tol);
+                case 3:
+                    return householder_python<3>(func, x0, max_iters, tol);
+                case 4:
+                    return householder_python<4>(func, x0, max_iters, tol);
+                default:
+                    throw std::invalid_argument("householder_method supports orders 1 through 4");
+            }
+        },
+        R"pbdoc(
+householder_method(func, x0, order=3, max_iters=100, tol=1e-8)
+
+Approximate a root using Householder's method of the given order from x0.
+func is called once per iteration with a Taylor<order> number.
+
+Parameters
+----------
+func : Callable[[TaylorN], TaylorN]
+x0 : float
+order : int, optional
+    Order of the method, 1 (Newton) through 4.
+max_iters : int, optional
+tol : float, optional
+
+Returns
+-------
+float
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("order") = 3,
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8
+    );
+
     /**
      * @brief Bind the Secant root approximation function to Python.
      */
@@ -279,4 +896,791 @@ tuple[float, float]
         py::arg("coefs"),
         py::arg("x0")
     );
+
+    /**
+     * @brief Bind zero-copy batched Horner evaluation to Python.
+     */
+    m.def(
+        "horners_batch",
+        [](const py::buffer& coefs, const py::buffer& x, const py::buffer& values, const py::buffer& derivatives) {
+            const py::buffer_info coefs_info = float64_vector(coefs, "coefs", false);
+            const py::buffer_info x_info = float64_vector(x, "x", false);
+            const py::buffer_info values_info = float64_vector(values, "values", true);
+            const py::buffer_info derivatives_info = float64_vector(derivatives, "derivatives", true);
+            if (coefs_info.shape[0] == 0) {
+                throw std::invalid_argument("coefs must have at least one coefficient");
+            }
+            if (values_info.shape[0] != x_info.shape[0] || derivatives_info.shape[0] != x_info.shape[0]) {
+                throw std::invalid_argument("values and derivatives must have one entry per point");
+            }
+            py::gil_scoped_release release;
+            horners_batch(
+                static_cast<int>(coefs_info.shape[0]) - 1,
+                static_cast<const double*>(coefs_info.ptr),
+                static_cast<const double*>(x_info.ptr),
+                static_cast<double*>(values_info.ptr),
+                static_cast<double*>(derivatives_info.ptr),
+                static_cast<long long>(x_info.shape[0])
+            );
+        },
+        R"pbdoc(
+horners_batch(coefs, x, values, derivatives)
+
+Evaluate polynomial value and derivative at every point of x using
+Horner's method, writing into caller-provided arrays.
+
+The arrays are accessed through the buffer protocol without copying, and
+the GIL is released while evaluating. values or derivatives may be x itself.
+
+Parameters
+----------
+coefs : buffer of float64
+    Polynomial coefficients from highest to lowest degree.
+x : buffer of float64
+    One-dimensional, contiguous array of points.
+values : writeable buffer of float64
+    Output for the polynomial values, one entry per point.
+derivatives : writeable buffer of float64
+    Output for the derivative values, one entry per point.
+
+Returns
+-------
+None
+)pbdoc",
+        py::arg("coefs"),
+        py::arg("x"),
+        py::arg("values"),
+        py::arg("derivatives")
+    );
+
+    /**
+     * @brief Bind the interval Newton root enclosure method to Python.
+     */
+    m.def(
+        "interval_newton",
+        &interval_newton,
+        R"pbdoc(
+interval_newton(func, dfunc, a, b, max_iters=100, tol=1e-10, num_threads=0)
+
+Enclose every root on [a, b] using the interval Newton method with
+bisection. Subdivision runs on num_threads worker threads; Python callables
+are serialized by the GIL.
+
+Parameters
+----------
+func : Callable[[Interval], Interval]
+    Interval extension of f.
+dfunc : Callable[[Interval], Interval]
+    Interval extension of f'.
+a, b : float
+max_iters : int, optional
+    Maximum subdivision depth.
+tol : float, optional
+    Width below which an enclosure is reported.
+num_threads : int, optional
+    Worker threads; 0 uses all cores.
+
+Returns
+-------
+list[RootEnclosure]
+    Enclosures sorted by lower endpoint; ``unique`` marks enclosures
+    proven to contain exactly one root.
+)pbdoc",
+        py::arg("func"),
+        py::arg("dfunc"),
+        py::arg("a"),
+        py::arg("b"),
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-10,
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    /**
+     * @brief Bind the Chebyshev proxy root finder to Python.
+     */
+    m.def(
+        "chebyshev_roots",
+        &chebyshev_roots,
+        R"pbdoc(
+chebyshev_roots(func, a, b, max_degree=128, tol=1e-13)
+
+Find every root on [a, b] from an adaptive Chebyshev interpolant of a smooth
+function. Intervals needing more than max_degree are subdivided.
+
+Parameters
+----------
+func : Callable[[float], float]
+a, b : float
+max_degree : int, optional
+tol : float, optional
+    Relative tolerance for the Chebyshev coefficients.
+
+Returns
+-------
+list[float]
+    Sorted roots in [a, b].
+)pbdoc",
+        py::arg("func"),
+        py::arg("a"),
+        py::arg("b"),
+        py::arg("max_degree") = 128,
+        py::arg("tol") = 1e-13
+    );
+
+    /**
+     * @brief Bind the reason a bounded solve stopped.
+     */
+    py::enum_<SolveStatus>(m, "SolveStatus", "Reason a solve stopped.")
+        .value("CONVERGED", SolveStatus::CONVERGED)
+        .value("MAX_ITERATIONS", SolveStatus::MAX_ITERATIONS)
+        .value("DEADLINE_EXCEEDED", SolveStatus::DEADLINE_EXCEEDED)
+        .value("BUDGET_EXHAUSTED", SolveStatus::BUDGET_EXHAUSTED)
+        .value("CANCELLED", SolveStatus::CANCELLED);
+
+    /**
+     * @brief Bind the thread-safe cancellation token.
+     */
+    py::class_<CancellationToken>(m, "CancellationToken", R"pbdoc(
+Flag shared between a running solve and other threads; ``cancel()`` stops
+the solve before its next function evaluation.
+)pbdoc")
+        .def(py::init<>())
+        .def("cancel", &CancellationToken::cancel)
+        .def_property_readonly("cancelled", &CancellationToken::cancelled);
+
+    /**
+     * @brief Bind the solve limits.
+     */
+    py::class_<SolveOptions>(m, "SolveOptions", R"pbdoc(
+Iteration, tolerance, wall-clock and evaluation limits for a solve.
+
+Parameters
+----------
+max_iters : int, optional
+tol : float, optional
+timeout : float, optional
+    Wall-clock budget in seconds, measured from construction.
+max_evaluations : int, optional
+    Function-evaluation budget; 0 means unlimited.
+cancellation : CancellationToken, optional
+)pbdoc")
+        .def(
+            py::init([](int max_iters, double tol, std::optional<double> timeout, long long max_evaluations, std::optional<CancellationToken> cancellation) {
+                SolveOptions options;
+                options.max_iters = max_iters;
+                options.tol = tol;
+                if (timeout) {
+                    options.set_timeout(*timeout);
+                }
+                options.max_evaluations = max_evaluations;
+                options.cancellation = cancellation;
+                return options;
+            }),
+            py::arg("max_iters") = 100,
+            py::arg("tol") = 1e-8,
+            py::arg("timeout") = py::none(),
+            py::arg("max_evaluations") = 0,
+            py::arg("cancellation") = py::none()
+        )
+        .def_readwrite("max_iters", &SolveOptions::max_iters)
+        .def_readwrite("tol", &SolveOptions::tol)
+        .def_readwrite("max_evaluations", &SolveOptions::max_evaluations)
+        .def_readwrite("cancellation", &SolveOptions::cancellation)
+        .def("set_timeout", &SolveOptions::set_timeout, py::arg("seconds"));
+
+    /**
+     * @brief Bind the outcome of a bounded solve.
+     */
+    py::class_<SolveResult>(m, "SolveResult", R"pbdoc(
+Outcome of a solve: ``root`` (best estimate), ``status``, ``iterations``,
+``evaluations``, ``residual`` (smallest observed abs(f)), ``error`` (final
+convergence measure) and ``bracket_lower``/``bracket_upper`` (tightest sign
+change seen, NaN if none).
+)pbdoc")
+        .def_readonly("root", &SolveResult::root)
+        .def_readonly("status", &SolveResult::status)
+        .def_readonly("iterations", &SolveResult::iterations)
+        .def_readonly("evaluations", &SolveResult::evaluations)
+        .def_readonly("residual", &SolveResult::residual)
+        .def_readonly("error", &SolveResult::error)
+        .def_readonly("bracket_lower", &SolveResult::bracket_lower)
+        .def_readonly("bracket_upper", &SolveResult::bracket_upper)
+        .def("__repr__", [](const SolveResult& result) {
+            std::ostringstream out;
+            out.precision(17);
+            out << "SolveResult(root=" << result.root << ", iterations=" << result.iterations
+                << ", evaluations=" << result.evaluations << ")";
+            return out.str();
+        });
+
+    /**
+     * @brief Bind the compiled-expression overloads taking SolveOptions. They
+     * are registered before the callable overloads below, which would
+     * otherwise accept a CompiledExpression through its __call__.
+     */
+    m.def(
+        "bisection",
+        [](const CompiledExpression& func, double a, double b, const SolveOptions& options, const std::vector<double>& params) {
+            return bisection([&func, &params](double x) { return func.evaluate(x, params); }, a, b, options);
+        },
+        R"pbdoc(
+bisection(func, a, b, options, params=[])
+
+Bisection on a compiled expression under solve limits.
+
+Parameters
+----------
+func : CompiledExpression or str
+a, b : float
+    Endpoints of an interval on which func changes sign.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+params : list[float], optional
+    Values of p0, p1, ... in func.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("a"),
+        py::arg("b"),
+        py::arg("options"),
+        py::arg("params") = std::vector<double>{},
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "newton_method",
+        [](const CompiledExpression& func, double x0, const SolveOptions& options, const std::vector<double>& params) {
+            const std::function<std::tuple<double, double>(double)> f_df = [&func, &params](double x) {
+                return func.evaluate_derivative(x, params);
+            };
+            return newton_method(f_df, x0, options);
+        },
+        R"pbdoc(
+newton_method(func, x0, options, params=[])
+
+Newton's method on a compiled expression under solve limits, with f' taken
+from the derivative tape. Each iteration is one pass of the tape and counts
+as one evaluation.
+
+Parameters
+----------
+func : CompiledExpression or str
+x0 : float
+    Initial approximation.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+params : list[float], optional
+    Values of p0, p1, ... in func.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("options"),
+        py::arg("params") = std::vector<double>{},
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "secant_method",
+        [](const CompiledExpression& func, double x0, double x1, const SolveOptions& options, const std::vector<double>& params) {
+            return secant_method([&func, &params](double x) { return func.evaluate(x, params); }, x0, x1, options);
+        },
+        R"pbdoc(
+secant_method(func, x0, x1, options, params=[])
+
+Secant method on a compiled expression under solve limits.
+
+Parameters
+----------
+func : CompiledExpression or str
+x0, x1 : float
+    Initial approximations.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+params : list[float], optional
+    Values of p0, p1, ... in func.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("x1"),
+        py::arg("options"),
+        py::arg("params") = std::vector<double>{},
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "newton_method_batch",
+        py::overload_cast<const CompiledExpression&, const std::vector<double>&, const std::vector<std::vector<double>>&, const SolveOptions&, int>(&newton_method_batch),
+        R"pbdoc(
+newton_method_batch(func, x0, params, options, num_threads=0)
+
+Parallel Newton solves of one compiled expression under solve limits. The
+iteration, tolerance and evaluation limits apply to each solve; the
+deadline and cancellation token are shared by all of them.
+
+Parameters
+----------
+func : CompiledExpression or str
+x0 : list[float]
+    Initial approximations, one per solve.
+params : list[list[float]]
+    No parameter sets, one shared set, or one set per solve.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+num_threads : int, optional
+    Worker threads; 0 uses all cores.
+
+Returns
+-------
+list[SolveResult]
+    One result per solve.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("params"),
+        py::arg("options"),
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    /**
+     * @brief Bind the overloads taking SolveOptions. They release the GIL and
+     * reacquire it only to call func, so other Python threads can cancel them.
+     */
+    using Function = std::function<double(double)>;
+    m.def(
+        "bisection",
+        py::overload_cast<const Function&, double, double, const SolveOptions&>(&bisection),
+        R"pbdoc(
+bisection(func, a, b, options)
+
+Bisection under solve limits.
+
+Parameters
+----------
+func : Callable[[float], float]
+a, b : float
+    Endpoints of an interval on which func changes sign.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("a"),
+        py::arg("b"),
+        py::arg("options"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "fixed_point",
+        py::overload_cast<const Function&, double, const SolveOptions&>(&fixed_point),
+        R"pbdoc(
+fixed_point(func, x0, options)
+
+Fixed-point iteration x = func(x) under solve limits.
+
+Parameters
+----------
+func : Callable[[float], float]
+x0 : float
+    Initial approximation.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Fixed-point estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("options"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "newton_method",
+        static_cast<SolveResult (*)(const Function&, double, const SolveOptions&)>(&newton_method),
+        R"pbdoc(
+newton_method(func, x0, options)
+
+Newton's method under solve limits, with f' approximated by centered finite
+differences whose two evaluations count towards the budget.
+
+Parameters
+----------
+func : Callable[[float], float]
+x0 : float
+    Initial approximation.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("options"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "halley_method",
+        static_cast<SolveResult (*)(const std::function<Taylor<2>(const Taylor<2>&)>&, double, const SolveOptions&)>(&halley_method),
+        R"pbdoc(
+halley_method(func, x0, options)
+
+Halley's method under solve limits, with derivatives from Taylor arithmetic.
+
+Parameters
+----------
+func : Callable[[Taylor2], Taylor2]
+x0 : float
+    Initial approximation.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("options"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "householder_method",
+        [](const py::function& func, double x0, int order, const SolveOptions& options) {
+            switch (order) {
+                case 1:
+                    return householder_options_python<1>(func, x0, options);
+                case 2:
+                    return householder_options_python<2>(func, x0, options);
+                case 3:
+                    return householder_options_python<3>(func, x0, options);
+                case 4:
+                    return householder_options_python<4>(func, x0, options);
+                default:
+                    throw std::invalid_argument("householder_method supports orders 1 through 4");
+            }
+        },
+        R"pbdoc(
+householder_method(func, x0, order, options)
+
+Householder's method of the given order under solve limits.
+
+Parameters
+----------
+func : Callable[[TaylorN], TaylorN]
+    Called once per iteration with a Taylor<order> number.
+x0 : float
+    Initial approximation.
+order : int
+    Order from 1 (Newton) to 4.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("order"),
+        py::arg("options")
+    );
+    m.def(
+        "secant_method",
+        py::overload_cast<const Function&, double, double, const SolveOptions&>(&secant_method),
+        R"pbdoc(
+secant_method(func, x0, x1, options)
+
+Secant method under solve limits.
+
+Parameters
+----------
+func : Callable[[float], float]
+x0, x1 : float
+    Initial approximations.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("x1"),
+        py::arg("options"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "false_position",
+        py::overload_cast<const Function&, double, double, const SolveOptions&>(&false_position),
+        R"pbdoc(
+false_position(func, x0, x1, options)
+
+Method of false position under solve limits.
+
+Parameters
+----------
+func : Callable[[float], float]
+x0, x1 : float
+    Initial approximations on either side of the root.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("x1"),
+        py::arg("options"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "steffensen_method",
+        py::overload_cast<const Function&, double, const SolveOptions&>(&steffensen_method),
+        R"pbdoc(
+steffensen_method(func, x0, options)
+
+Steffensen's acceleration of fixed-point iteration x = func(x) under solve
+limits.
+
+Parameters
+----------
+func : Callable[[float], float]
+x0 : float
+    Initial approximation.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Fixed-point estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("options"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+    m.def(
+        "mullers",
+        py::overload_cast<const Function&, double, double, double, const SolveOptions&>(&mullers),
+        R"pbdoc(
+mullers(func, p0, p1, p2, options)
+
+Muller's method under solve limits.
+
+Parameters
+----------
+func : Callable[[float], float]
+p0, p1, p2 : float
+    Initial approximations.
+options : SolveOptions
+    Iteration, tolerance and resource limits.
+
+Returns
+-------
+SolveResult
+    Root estimate, status and counters.
+)pbdoc",
+        py::arg("func"),
+        py::arg("p0"),
+        py::arg("p1"),
+        py::arg("p2"),
+        py::arg("options"),
+        py::call_guard<py::gil_scoped_release>()
+    );
+
+    /**
+     * @brief Bind the solver selection for streamed records.
+     */
+    py::enum_<StreamMethod>(m, "StreamMethod", "Solver applied to every streamed record.")
+        .value("NEWTON", StreamMethod::NEWTON)
+        .value("SECANT", StreamMethod::SECANT);
+
+    /**
+     * @brief Bind the totals of a streamed solve.
+     */
+    py::class_<StreamStatistics>(m, "StreamStatistics", "Totals over a streamed solve.")
+        .def_readonly("records", &StreamStatistics::records)
+        .def_readonly("converged", &StreamStatistics::converged)
+        .def_readonly("evaluations", &StreamStatistics::evaluations)
+        .def_readonly("chunks", &StreamStatistics::chunks);
+
+    /**
+     * @brief Bind the streaming out-of-core batch solver.
+     */
+    m.def(
+        "solve_stream",
+        &solve_stream,
+        py::arg("func"),
+        py::arg("input_path"),
+        py::arg("output_path"),
+        py::arg("method") = StreamMethod::NEWTON,
+        py::arg("options") = SolveOptions{},
+        py::arg("chunk_records") = 65536,
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>(),
+        R"pbdoc(
+Solve a memory-mapped file of parametrized problems chunk by chunk.
+
+The input file holds native-endian float64 records ``[x0, p0, ..., pm]``
+with one parameter per ``p`` in ``func``. The output file is overwritten
+with one 16-byte record per input record, readable with the NumPy dtype
+``[("root", "f8"), ("status", "i4"), ("iterations", "i4")]``; ``status`` is
+the integer value of ``SolveStatus``. The next input chunk is read ahead
+while the current one is solved in parallel, and finished output is written
+back in the background, so memory use stays bounded by a few chunks.
+
+Parameters
+----------
+func : CompiledExpression
+    Function of x and its parameters.
+input_path : str
+    Parameter file.
+output_path : str
+    Result file, created or truncated.
+method : StreamMethod, optional
+    Solver applied to each record.
+options : SolveOptions, optional
+    Per-record iteration, tolerance and evaluation limits. The timeout and
+    cancellation token apply to the whole stream.
+chunk_records : int, optional
+    Records per chunk.
+num_threads : int, optional
+    Number of worker threads; 0 uses all hardware threads.
+
+Returns
+-------
+StreamStatistics
+    Record, convergence, evaluation and chunk counts.
+)pbdoc"
+    );
+
+    /**
+     * @brief Bind the result of a lane-batched solve.
+     */
+    py::class_<LaneBatchResult>(m, "LaneBatchResult", R"pbdoc(
+Per-problem ``roots``, ``iterations`` and ``status`` of a lane-batched
+solve, with ``batch_calls``, ``lane_evaluations`` and ``utilization`` (the
+fraction of lanes holding live problems per call).
+)pbdoc")
+        .def_readonly("roots", &LaneBatchResult::roots)
+        .def_readonly("iterations", &LaneBatchResult::iterations)
+        .def_readonly("status", &LaneBatchResult::status)
+        .def_readonly("batch_calls", &LaneBatchResult::batch_calls)
+        .def_readonly("lane_evaluations", &LaneBatchResult::lane_evaluations)
+        .def_readonly("utilization", &LaneBatchResult::utilization);
+
+    /**
+     * @brief Bind the lane-compacting batched Newton-Raphson method.
+     */
+    m.def(
+        "newton_method_lanes",
+        py::overload_cast<const CompiledExpression&, const std::vector<double>&, const std::vector<std::vector<double>>&, int, int, double>(&newton_method_lanes),
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("params") = std::vector<std::vector<double>>{},
+        py::arg("lanes") = 64,
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8,
+        py::call_guard<py::gil_scoped_release>(),
+        R"pbdoc(
+Solve many parametrized problems with Newton's method on dense lanes.
+
+Problems are iterated in lock step on ``lanes`` lanes. After each step,
+finished problems are retired, the remaining lanes are compacted and the
+freed lanes are refilled from the queue, so lanes stay busy even when
+iteration counts vary widely between problems.
+
+Parameters
+----------
+func : CompiledExpression
+    Function of x and its parameters.
+x0 : list of float
+    Initial approximations, one per problem.
+params : list of list of float, optional
+    No parameter sets, one shared by every problem, or one per problem.
+lanes : int, optional
+    Number of lanes.
+max_iters : int, optional
+    Maximum number of iterations per problem.
+tol : float, optional
+    Convergence tolerance.
+
+Returns
+-------
+LaneBatchResult
+    Roots, iteration counts and statuses in problem order.
+)pbdoc"
+    );
+
+    /**
+     * @brief Bind the lane-compacting batched Secant method.
+     */
+    m.def(
+        "secant_method_lanes",
+        py::overload_cast<const CompiledExpression&, const std::vector<double>&, const std::vector<double>&, const std::vector<std::vector<double>>&, int, int, double>(&secant_method_lanes),
+        py::arg("func"),
+        py::arg("x0"),
+        py::arg("x1"),
+        py::arg("params") = std::vector<std::vector<double>>{},
+        py::arg("lanes") = 64,
+        py::arg("max_iters") = 100,
+        py::arg("tol") = 1e-8,
+        py::call_guard<py::gil_scoped_release>(),
+        R"pbdoc(
+Solve many parametrized problems with the Secant method on dense lanes.
+
+Lanes are retired, compacted and refilled as in ``newton_method_lanes``.
+
+Parameters
+----------
+func : CompiledExpression
+    Function of x and its parameters.
+x0 : list of float
+    First initial approximations, one per problem.
+x1 : list of float
+    Second initial approximations, one per problem.
+params : list of list of float, optional
+    No parameter sets, one shared by every problem, or one per problem.
+lanes : int, optional
+    Number of lanes.
+max_iters : int, optional
+    Maximum number of iterations per problem.
+tol : float, optional
+    Convergence tolerance.
+
+Returns
+-------
+LaneBatchResult
+    Roots, iteration counts and statuses in problem order.
+)pbdoc"
+    );
 }
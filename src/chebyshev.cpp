@@ -0,0 +1,539 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "numeric/chebyshev.hpp"
+
+namespace {
+
+/**
+ * @brief Whether n is a positive power of two.
+ *
+ * @param n Integer.
+ * @return Whether n = 2^k for some k >= 0.
+ */
+bool is_power_of_two(int n){
+    return n > 0 && (n & (n - 1)) == 0;
+}
+
+/**
+ * @brief In-place iterative radix-2 fast Fourier transform,
+ * X_k = sum_j x_j exp(-2 pi i j k / n).
+ *
+ * @param data Sequence whose length is a power of two.
+ */
+void fft(std::vector<std::complex<double>>& data){
+    const int n = static_cast<int>(data.size());
+
+    for (int ii = 1, jj = 0; ii < n; ii++) {
+        int bit = n >> 1;
+        for (; jj & bit; bit >>= 1) {
+            jj ^= bit;
+        }
+        jj ^= bit;
+        if (ii < jj) {
+            std::swap(data[ii], data[jj]);
+        }
+    }
+
+    for (int length = 2; length <= n; length <<= 1) {
+        const double angle = -2.0 * M_PI / length;
+        const std::complex<double> root{std::cos(angle), std::sin(angle)};
+        for (int start = 0; start < n; start += length) {
+            std::complex<double> w{1.0, 0.0};
+            for (int kk = 0; kk < length / 2; kk++) {
+                const std::complex<double> even = data[start + kk];
+                const std::complex<double> odd = data[start + kk + length / 2] * w;
+                data[start + kk] = even + odd;
+                data[start + kk + length / 2] = even - odd;
+                w *= root;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Balance a real n x n matrix by diagonal similarity transforms with
+ * powers of two, reducing the norm and the rounding error of the eigenvalues.
+ *
+ * @param A Row-major matrix, modified in place.
+ * @param n Dimension.
+ */
+void balance(std::vector<double>& A, int n){
+    const double radix = 2.0;
+    bool done = false;
+    while (!done) {
+        done = true;
+        for (int ii = 0; ii < n; ii++) {
+            double r = 0.0;
+            double c = 0.0;
+            for (int jj = 0; jj < n; jj++) {
+                if (jj != ii) {
+                    c += std::abs(A[jj * n + ii]);
+                    r += std::abs(A[ii * n + jj]);
+                }
+            }
+            if (c == 0.0 || r == 0.0) {
+                continue;
+            }
+            double g = r / radix;
+            double f = 1.0;
+            const double s = c + r;
+            while (c < g) {
+                f *= radix;
+                c *= radix * radix;
+            }
+            g = r * radix;
+            while (c > g) {
+                f /= radix;
+                c /= radix * radix;
+            }
+            if ((c + r) / f < 0.95 * s) {
+                done = false;
+                for (int jj = 0; jj < n; jj++) {
+                    A[ii * n + jj] /= f;
+                    A[jj * n + ii] *= f;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Eigenvalues of a real upper Hessenberg matrix by the Francis
+ * double-shift QR algorithm.
+ *
+ * @param A Row-major upper Hessenberg matrix, destroyed.
+ * @param n Dimension.
+ * @return The n eigenvalues.
+ */
+std::vector<std::complex<double>> hessenberg_eigenvalues(std::vector<double>& A, int n){
+    const double eps = std::numeric_limits<double>::epsilon();
+    const auto a = [&A, n](int ii, int jj) -> double& { return A[ii * n + jj]; };
+    std::vector<std::complex<double>> eigenvalues;
+    eigenvalues.assign(n, 0.0);
+
+    double norm = 0.0;
+    for (int ii = 0; ii < n; ii++) {
+        for (int jj = std::max(ii - 1, 0); jj < n; jj++) {
+            norm += std::abs(a(ii, jj));
+        }
+    }
+
+    int nn = n - 1;
+    double t = 0.0;
+    while (nn >= 0) {
+        int its = 0;
+        int l;
+        do {
+            // Look for a single small subdiagonal element.
+            for (l = nn; l > 0; l--) {
+                double s = std::abs(a(l - 1, l - 1)) + std::abs(a(l, l));
+                if (s == 0.0) {
+                    s = norm;
+                }
+                if (std::abs(a(l, l - 1)) <= eps * s) {
+                    a(l, l - 1) = 0.0;
+                    break;
+                }
+            }
+
+            double x = a(nn, nn);
+            if (l == nn) {
+                // One root found.
+                eigenvalues[nn] = x + t;
+                nn -= 1;
+                continue;
+            }
+
+            double y = a(nn - 1, nn - 1);
+            double w = a(nn, nn - 1) * a(nn - 1, nn);
+            if (l == nn - 1) {
+                // Two roots found.
+                const double p = 0.5 * (y - x);
+                const double q = p * p + w;
+                double z = std::sqrt(std::abs(q));
+                x += t;
+                if (q >= 0.0) {
+                    z = p + std::copysign(z, p);
+                    eigenvalues[nn - 1] = x + z;
+                    eigenvalues[nn] = z != 0.0 ? x - w / z : x + z;
+                } else {
+                    eigenvalues[nn] = std::complex<double>(x + p, -z);
+                    eigenvalues[nn - 1] = std::conj(eigenvalues[nn]);
+                }
+                nn -= 2;
+                continue;
+            }
+
+            if (its == 60) {
+                throw std::runtime_error("Hessenberg QR iteration did not converge");
+            }
+            if (its == 10 || its == 20) {
+                // Exceptional shift.
+                t += x;
+                for (int ii = 0; ii <= nn; ii++) {
+                    a(ii, ii) -= x;
+                }
+                const double s = std::abs(a(nn, nn - 1)) + std::abs(a(nn - 1, nn - 2));
+                x = 0.75 * s;
+                y = x;
+                w = -0.4375 * s * s;
+            }
+            its += 1;
+
+            // Form the shift and look for two consecutive small subdiagonal elements.
+            int m;
+            double p = 0.0, q = 0.0, r = 0.0, z = 0.0;
+            for (m = nn - 2; m >= l; m--) {
+                z = a(m, m);
+                r = x - z;
+                double s = y - z;
+                p = (r * s - w) / a(m + 1, m) + a(m, m + 1);
+                q = a(m + 1, m + 1) - z - r - s;
+                r = a(m + 2, m + 1);
+                s = std::abs(p) + std::abs(q) + std::abs(r);
+                p /= s;
+                q /= s;
+                r /= s;
+                if (m == l) {
+                    break;
+                }
+                const double u = std::abs(a(m, m - 1)) * (std::abs(q) + std::abs(r));
+                const double v = std::abs(p)
+                    * (std::abs(a(m - 1, m - 1)) + std::abs(z) + std::abs(a(m + 1, m + 1)));
+                if (u <= eps * v) {
+                    break;
+                }
+            }
+            for (int ii = m; ii < nn - 1; ii++) {
+                a(ii + 2, ii) = 0.0;
+                if (ii != m) {
+                    a(ii + 2, ii - 1) = 0.0;
+                }
+            }
+
+            // Double QR step on rows l..nn and columns m..nn.
+            for (int k = m; k < nn; k++) {
+                if (k != m) {
+                    p = a(k, k - 1);
+                    q = a(k + 1, k - 1);
+                    r = k + 1 != nn ? a(k + 2, k - 1) : 0.0;
+                    x = std::abs(p) + std::abs(q) + std::abs(r);
+                    if (x != 0.0) {
+                        p /= x;
+                        q /= x;
+                        r /= x;
+                    }
+                }
+                const double s = std::copysign(std::sqrt(p * p + q * q + r * r), p);
+                if (s == 0.0) {
+                    continue;
+                }
+                if (k == m) {
+                    if (l != m) {
+                        a(k, k - 1) = -a(k, k - 1);
+                    }
+                } else {
+                    a(k, k - 1) = -s * x;
+                }
+                p += s;
+                x = p / s;
+                y = q / s;
+                z = r / s;
+                q /= p;
+                r /= p;
+                for (int jj = k; jj <= nn; jj++) {
+                    p = a(k, jj) + q * a(k + 1, jj);
+                    if (k + 1 != nn) {
+                        p += r * a(k + 2, jj);
+                        a(k + 2, jj) -= p * z;
+                    }
+                    a(k + 1, jj) -= p * y;
+                    a(k, jj) -= p * x;
+                }
+                const int last = std::min(nn, k + 3);
+                for (int ii = l; ii <= last; ii++) {
+                    p = x * a(ii, k) + y * a(ii, k + 1);
+                    if (k + 1 != nn) {
+                        p += z * a(ii, k + 2);
+                        a(ii, k + 2) -= p * r;
+                    }
+                    a(ii, k + 1) -= p * q;
+                    a(ii, k) -= p;
+                }
+            }
+        } while (nn >= 0 && l < nn - 1);
+    }
+    return eigenvalues;
+}
+
+}  // namespace
+
+/**
+ * @brief Evaluate the series and its derivative at x.
+ *
+ * @param x Point in [a, b].
+ * @return Tuple of p(x) and p'(x).
+ */
+std::tuple<double, double> ChebyshevSeries::evaluate(double x) const {
+    if (coefs.empty()) {
+        return {0.0, 0.0};
+    }
+    const double t = (2.0 * x - a - b) / (b - a);
+    const auto [value, derivative] = clenshaw(static_cast<int>(coefs.size()) - 1, coefs.data(), t);
+    return {value, derivative * 2.0 / (b - a)};
+}
+
+/**
+ * @brief Chebyshev points of the second kind x_j = cos(j pi / n), j = 0..n,
+ * mapped to [a, b].
+ *
+ * @param n Degree; n + 1 points are returned.
+ * @param a Left endpoint of the interval.
+ * @param b Right endpoint of the interval.
+ * @return Points ordered from b down to a.
+ */
+std::vector<double> chebyshev_points(int n, double a, double b){
+    if (n < 1) {
+        throw std::invalid_argument("Chebyshev points expect a positive degree");
+    }
+    std::vector<double> points;
+    points.reserve(n + 1);
+    for (int jj = 0; jj <= n; jj++) {
+        // sin form is symmetric and exact at the endpoints and center.
+        const double t = std::sin(M_PI * (n - 2 * jj) / (2.0 * n));
+        points.push_back(0.5 * (a + b) + 0.5 * (b - a) * t);
+    }
+    return points;
+}
+
+/**
+ * @brief Coefficients of the degree n polynomial interpolating values at the
+ * n + 1 Chebyshev points of the second kind.
+ *
+ * @param values Function values at chebyshev_points(n, a, b).
+ * @return Coefficients c_0..c_n.
+ */
+std::vector<double> chebyshev_coefficients(const std::vector<double>& values){
+    const int n = static_cast<int>(values.size()) - 1;
+    if (n < 1) {
+        throw std::invalid_argument("Chebyshev coefficients expect at least two values");
+    }
+
+    std::vector<double> coefs;
+    coefs.assign(n + 1, 0.0);
+
+    if (is_power_of_two(n)) {
+        // DCT-I through the FFT of the even extension of length 2n.
+        std::vector<std::complex<double>> extension;
+        extension.assign(2 * n, 0.0);
+        for (int jj = 0; jj <= n; jj++) {
+            extension[jj] = values[jj];
+        }
+        for (int jj = 1; jj < n; jj++) {
+            extension[2 * n - jj] = values[jj];
+        }
+        fft(extension);
+        for (int kk = 0; kk <= n; kk++) {
+            coefs[kk] = extension[kk].real() / n;
+        }
+    } else {
+        for (int kk = 0; kk <= n; kk++) {
+            double sum = 0.5 * (values[0] + (kk % 2 == 0 ? values[n] : -values[n]));
+            for (int jj = 1; jj < n; jj++) {
+                sum += values[jj] * std::cos(M_PI * jj * kk / n);
+            }
+            coefs[kk] = 2.0 * sum / n;
+        }
+    }
+
+    coefs[0] *= 0.5;
+    coefs[n] *= 0.5;
+    return coefs;
+}
+
+/**
+ * @brief Evaluate a Chebyshev series and its derivative at t in [-1, 1] with
+ * Clenshaw's recurrence, the Chebyshev analogue of Horner's method.
+ *
+ * @param n The degree of the series.
+ * @param coefs List of length n+1 of Chebyshev coefficients c_0..c_n.
+ * @param x0 Value that is being evaluated.
+ * @return Tuple of the series and derivative at x0.
+ */
+std::tuple<double, double> clenshaw(int n, const double coefs[], double x0){
+    if (n < 0) {
+        throw std::invalid_argument("Clenshaw's expects non-negative series degree");
+    }
+
+    // Step 1
+    double b1 = 0.0, b2 = 0.0;
+    double d1 = 0.0, d2 = 0.0;
+
+    // Step 2
+    for (int kk = n; kk >= 1; kk--) {
+        const double b0 = coefs[kk] + 2.0 * x0 * b1 - b2;
+        const double d0 = 2.0 * b1 + 2.0 * x0 * d1 - d2;
+        b2 = b1;
+        b1 = b0;
+        d2 = d1;
+        d1 = d0;
+    }
+
+    // Step 3
+    return {coefs[0] + x0 * b1 - b2, b1 + x0 * d1 - d2};
+}
+
+/**
+ * @brief Adaptively interpolate f on [a, b] at 17, 33, 65, ... Chebyshev
+ * points, reusing every previous sample, until the trailing coefficients fall
+ * below TOL relative to the largest coefficient.
+ *
+ * @param func Continuous function f(x).
+ * @param a Left endpoint of the interval.
+ * @param b Right endpoint of the interval.
+ * @param MAX_DEGREE Largest degree attempted.
+ * @param TOL Relative coefficient tolerance.
+ * @return Series; resolved is false when MAX_DEGREE was insufficient.
+ */
+ChebyshevSeries chebyshev_fit(
+    const std::function<double(double)>& func,
+    double a,
+    double b,
+    int MAX_DEGREE,
+    double TOL
+){
+    if (!(a < b)) {
+        throw std::invalid_argument("Chebyshev fit expects a < b");
+    }
+    if (MAX_DEGREE < 2) {
+        throw std::invalid_argument("Chebyshev fit expects MAX_DEGREE >= 2");
+    }
+
+    ChebyshevSeries series;
+    series.a = a;
+    series.b = b;
+
+    // Step 1
+    int n = std::min(16, MAX_DEGREE);
+    std::vector<double> values;
+    for (double x : chebyshev_points(n, a, b)) {
+        values.push_back(func(x));
+    }
+
+    while (true) {
+        // Step 2
+        series.coefs = chebyshev_coefficients(values);
+        double scale = 0.0;
+        for (double c : series.coefs) {
+            scale = std::max(scale, std::abs(c));
+        }
+
+        // Step 3
+        const int tail = std::max(2, n / 8);
+        bool converged = true;
+        for (int kk = n - tail + 1; kk <= n; kk++) {
+            converged = converged && std::abs(series.coefs[kk]) <= TOL * scale;
+        }
+
+        if (converged || scale == 0.0) {
+            series.resolved = true;
+            int degree = n;
+            while (degree > 0 && std::abs(series.coefs[degree]) <= TOL * scale) {
+                degree -= 1;
+            }
+            series.coefs.resize(degree + 1);
+            return series;
+        }
+
+        // Step 4
+        if (2 * n > MAX_DEGREE) {
+            series.resolved = false;
+            return series;
+        }
+
+        // Step 5: the even points of degree 2n are the points of degree n.
+        const std::vector<double> points = chebyshev_points(2 * n, a, b);
+        std::vector<double> refined;
+        refined.reserve(2 * n + 1);
+        for (int jj = 0; jj <= 2 * n; jj++) {
+            refined.push_back(jj % 2 == 0 ? values[jj / 2] : func(points[jj]));
+        }
+        values.swap(refined);
+        n *= 2;
+    }
+}
+
+/**
+ * @brief Real roots of a Chebyshev series on its interval, computed as
+ * eigenvalues of the colleague matrix and polished with Newton steps on the
+ * series.
+ *
+ * @param series Chebyshev series.
+ * @return Sorted roots in [series.a, series.b].
+ */
+std::vector<double> chebyshev_series_roots(const ChebyshevSeries& series){
+    const int n = static_cast<int>(series.coefs.size()) - 1;
+    const std::vector<double>& c = series.coefs;
+    std::vector<double> roots;
+    if (n < 1) {
+        return roots;
+    }
+
+    // Step 1
+    std::vector<double> candidates;
+    if (n == 1) {
+        candidates.push_back(-c[0] / c[1]);
+    } else {
+        // Transposed colleague matrix, which is upper Hessenberg.
+        std::vector<double> A;
+        A.assign(n * n, 0.0);
+        A[1 * n + 0] = 1.0;
+        for (int kk = 1; kk < n - 1; kk++) {
+            A[(kk - 1) * n + kk] = 0.5;
+            A[(kk + 1) * n + kk] = 0.5;
+        }
+        A[(n - 2) * n + (n - 1)] += 0.5;
+        for (int kk = 0; kk < n; kk++) {
+            A[kk * n + (n - 1)] -= c[kk] / (2.0 * c[n]);
+        }
+
+        // Step 2
+        balance(A, n);
+        for (const std::complex<double>& eigenvalue : hessenberg_eigenvalues(A, n)) {
+            const double t = eigenvalue.real();
+            if (std::abs(eigenvalue.imag()) <= 1e-8 && std::abs(t) <= 1.0 + 1e-8) {
+                candidates.push_back(t);
+            }
+        }
+    }
+
+    // Step 3
+    for (double t : candidates) {
+        if (!(std::abs(t) <= 1.0 + 1e-8)) {
+            continue;
+        }
+        t = std::max(-1.0, std::min(1.0, t));
+        for (int ii = 0; ii < 3; ii++) {
+            const auto [value, derivative] = clenshaw(n, c.data(), t);
+            if (derivative == 0.0) {
+                break;
+            }
+            const double step = value / derivative;
+            if (std::abs(t - step) > 1.0) {
+                break;
+            }
+            t -= step;
+        }
+        roots.push_back(0.5 * (series.a + series.b) + 0.5 * (series.b - series.a) * t);
+    }
+
+    // Step 4
+    std::sort(roots.begin(), roots.end());
+    return roots;
+}
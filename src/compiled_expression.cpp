@@ -0,0 +1,962 @@
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "numeric/compiled_expression.hpp"
+#include "numeric/root_approximation.hpp"
+#include "numeric/thread_pool.hpp"
+
+namespace {
+
+/**
+ * @brief Node of the syntax tree built by the parser.
+ */
+struct Node {
+    Opcode op = Opcode::CONSTANT;
+    int index = 0;
+    double constant = 0.0;
+    std::unique_ptr<Node> lhs;
+    std::unique_ptr<Node> rhs;
+
+    /**
+     * @brief Release the subtree iteratively; a chain such as x + x + ... + x
+     * is as deep as it is long and would overflow the stack if each node
+     * destroyed its operands recursively.
+     */
+    ~Node(){
+        std::vector<std::unique_ptr<Node>> pending;
+        pending.push_back(std::move(lhs));
+        pending.push_back(std::move(rhs));
+        while (!pending.empty()) {
+            std::unique_ptr<Node> node = std::move(pending.back());
+            pending.pop_back();
+            if (node) {
+                pending.push_back(std::move(node->lhs));
+                pending.push_back(std::move(node->rhs));
+            }
+        }
+    }
+};
+
+/**
+ * @brief Allocate a syntax tree node without operands.
+ *
+ * @param op Opcode of the node.
+ * @return New node.
+ */
+std::unique_ptr<Node> leaf(Opcode op){
+    std::unique_ptr<Node> node = std::make_unique<Node>();
+    node->op = op;
+    return node;
+}
+
+/**
+ * @brief Whether an opcode takes a single operand.
+ *
+ * @param op Opcode.
+ * @return Whether op is unary.
+ */
+bool is_unary(Opcode op){
+    switch (op) {
+        case Opcode::NEGATE:
+        case Opcode::POWER_INT:
+        case Opcode::EXP:
+        case Opcode::LOG:
+        case Opcode::SQRT:
+        case Opcode::SIN:
+        case Opcode::COS:
+        case Opcode::TAN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Apply an arithmetic opcode to values; shared by constant folding and
+ * the interpreter.
+ *
+ * @param op Opcode other than CONSTANT, VARIABLE and PARAMETER.
+ * @param a First operand.
+ * @param b Second operand, ignored by unary opcodes.
+ * @param index Exponent for POWER_INT.
+ * @return op(a, b).
+ */
+inline double apply(Opcode op, double a, double b, int index){
+    switch (op) {
+        case Opcode::ADD:
+            return a + b;
+        case Opcode::SUBTRACT:
+            return a - b;
+        case Opcode::MULTIPLY:
+            return a * b;
+        case Opcode::DIVIDE:
+            return a / b;
+        case Opcode::NEGATE:
+            return -a;
+        case Opcode::POWER_INT: {
+            double base = index < 0 ? 1.0 / a : a;
+            unsigned int exponent = index < 0 ? -static_cast<unsigned int>(index) : static_cast<unsigned int>(index);
+            double result = 1.0;
+            while (exponent > 0) {
+                if (exponent & 1u) {
+                    result *= base;
+                }
+                base *= base;
+                exponent >>= 1u;
+            }
+            return result;
+        }
+        case Opcode::POWER:
+            return std::pow(a, b);
+        case Opcode::EXP:
+            return std::exp(a);
+        case Opcode::LOG:
+            return std::log(a);
+        case Opcode::SQRT:
+            return std::sqrt(a);
+        case Opcode::SIN:
+            return std::sin(a);
+        case Opcode::COS:
+            return std::cos(a);
+        case Opcode::TAN:
+            return std::tan(a);
+        default:
+            throw std::logic_error("Opcode has no arithmetic meaning");
+    }
+}
+
+/**
+ * @brief Recursive-descent parser producing a constant-folded syntax tree.
+ */
+class Parser {
+public:
+    /**
+     * @brief Prepare to parse a string.
+     *
+     * @param text Expression text.
+     */
+    explicit Parser(const std::string& text) : text_(text) {}
+
+    /**
+     * @brief Parse the whole string.
+     *
+     * @return Root of the syntax tree.
+     */
+    std::unique_ptr<Node> parse(){
+        std::unique_ptr<Node> root = parse_sum();
+        skip_space();
+        if (position_ != text_.size()) {
+            fail("unexpected character");
+        }
+        return root;
+    }
+
+    /**
+     * @brief Number of parameters referenced so far.
+     *
+     * @return One more than the largest parameter index.
+     */
+    int parameter_count() const {
+        return parameter_count_;
+    }
+
+private:
+    /**
+     * @brief Throw a parse error pointing at the current position.
+     *
+     * @param message Description of the problem.
+     */
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::invalid_argument(
+            "Expression parse error at position " + std::to_string(position_) + ": " + message
+        );
+    }
+
+    /**
+     * @brief Advance past whitespace.
+     */
+    void skip_space(){
+        while (position_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[position_]))) {
+            position_ += 1;
+        }
+    }
+
+    /**
+     * @brief Consume a token if it comes next.
+     *
+     * @param token Expected text.
+     * @return Whether the token was consumed.
+     */
+    bool accept(const char* token){
+        skip_space();
+        const std::string expected{token};
+        if (text_.compare(position_, expected.size(), expected) == 0) {
+            position_ += expected.size();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Build a leaf holding a constant.
+     *
+     * @param value Constant value.
+     * @return Leaf node.
+     */
+    static std::unique_ptr<Node> constant(double value){
+        std::unique_ptr<Node> node = leaf(Opcode::CONSTANT);
+        node->constant = value;
+        return node;
+    }
+
+    /**
+     * @brief Build an operation node, folding it when every operand is
+     * constant.
+     *
+     * @param op Opcode.
+     * @param lhs First operand.
+     * @param rhs Second operand, null for unary opcodes.
+     * @param index Exponent for POWER_INT.
+     * @return Operation or constant node.
+     */
+    static std::unique_ptr<Node> make(Opcode op, std::unique_ptr<Node> lhs, std::unique_ptr<Node> rhs, int index){
+        const bool constant_operands = lhs->op == Opcode::CONSTANT && (!rhs || rhs->op == Opcode::CONSTANT);
+        if (constant_operands) {
+            return constant(apply(op, lhs->constant, rhs ? rhs->constant : 0.0, index));
+        }
+        std::unique_ptr<Node> node = leaf(op);
+        node->index = index;
+        node->lhs = std::move(lhs);
+        node->rhs = std::move(rhs);
+        return node;
+    }
+
+    /**
+     * @brief sum := product (('+' | '-') product)*.
+     *
+     * @return Syntax tree.
+     */
+    std::unique_ptr<Node> parse_sum(){
+        std::unique_ptr<Node> node = parse_product();
+        while (true) {
+            if (accept("+")) {
+                node = make(Opcode::ADD, std::move(node), parse_product(), 0);
+            } else if (accept("-")) {
+                node = make(Opcode::SUBTRACT, std::move(node), parse_product(), 0);
+            } else {
+                return node;
+            }
+        }
+    }
+
+    /**
+     * @brief product := unary (('*' | '/') unary)*.
+     *
+     * @return Syntax tree.
+     */
+    std::unique_ptr<Node> parse_product(){
+        std::unique_ptr<Node> node = parse_unary();
+        while (true) {
+            skip_space();
+            if (text_.compare(position_, 2, "**") != 0 && accept("*")) {
+                node = make(Opcode::MULTIPLY, std::move(node), parse_unary(), 0);
+            } else if (accept("/")) {
+                node = make(Opcode::DIVIDE, std::move(node), parse_unary(), 0);
+            } else {
+                return node;
+            }
+        }
+    }
+
+    /**
+     * @brief unary := ('-' | '+') unary | power. Every recursive path of the
+     * grammar passes through here, so this is where nesting is bounded.
+     *
+     * @return Syntax tree.
+     */
+    std::unique_ptr<Node> parse_unary(){
+        if (depth_ >= CompiledExpression::MAX_DEPTH) {
+            fail("expression nests deeper than " + std::to_string(CompiledExpression::MAX_DEPTH) + " levels");
+        }
+        depth_ += 1;
+        std::unique_ptr<Node> node;
+        if (accept("-")) {
+            node = make(Opcode::NEGATE, parse_unary(), nullptr, 0);
+        } else if (accept("+")) {
+            node = parse_unary();
+        } else {
+            node = parse_power();
+        }
+        depth_ -= 1;
+        return node;
+    }
+
+    /**
+     * @brief power := primary (('**' | '^') unary)?; small integer exponents
+     * become POWER_INT.
+     *
+     * @return Syntax tree.
+     */
+    std::unique_ptr<Node> parse_power(){
+        std::unique_ptr<Node> base = parse_primary();
+        if (!accept("**") && !accept("^")) {
+            return base;
+        }
+        std::unique_ptr<Node> exponent = parse_unary();
+        if (exponent->op == Opcode::CONSTANT
+            && exponent->constant == std::floor(exponent->constant)
+            && std::abs(exponent->constant) <= 64.0) {
+            return make(Opcode::POWER_INT, std::move(base), nullptr, static_cast<int>(exponent->constant));
+        }
+        return make(Opcode::POWER, std::move(base), std::move(exponent), 0);
+    }
+
+    /**
+     * @brief primary := number | x | p<k> | pi | e | function '(' sum ')' |
+     * '(' sum ')'.
+     *
+     * @return Syntax tree.
+     */
+    std::unique_ptr<Node> parse_primary(){
+        skip_space();
+        if (position_ >= text_.size()) {
+            fail("unexpected end of expression");
+        }
+        if (accept("(")) {
+            std::unique_ptr<Node> node = parse_sum();
+            if (!accept(")")) {
+                fail("expected ')'");
+            }
+            return node;
+        }
+
+        const char next = text_[position_];
+        if (std::isdigit(static_cast<unsigned char>(next)) || next == '.') {
+            const char* begin = text_.c_str() + position_;
+            char* end = nullptr;
+            const double value = std::strtod(begin, &end);
+            if (end == begin) {
+                fail("malformed number");
+            }
+            position_ += end - begin;
+            return constant(value);
+        }
+
+        if (!std::isalpha(static_cast<unsigned char>(next)) && next != '_') {
+            fail("unexpected character");
+        }
+        const std::size_t start = position_;
+        while (position_ < text_.size()
+               && (std::isalnum(static_cast<unsigned char>(text_[position_])) || text_[position_] == '_')) {
+            position_ += 1;
+        }
+        const std::string name = text_.substr(start, position_ - start);
+
+        if (name == "x") {
+            return leaf(Opcode::VARIABLE);
+        }
+        if (name == "pi") {
+            return constant(M_PI);
+        }
+        if (name == "e") {
+            return constant(M_E);
+        }
+        if (name.size() > 1 && name[0] == 'p'
+            && name.find_first_not_of("0123456789", 1) == std::string::npos) {
+            int index = 0;
+            for (std::size_t ii = 1; ii < name.size(); ii++) {
+                index = 10 * index + (name[ii] - '0');
+                if (index >= CompiledExpression::MAX_PARAMETERS) {
+                    position_ = start;
+                    fail("parameter index exceeds " + std::to_string(CompiledExpression::MAX_PARAMETERS - 1));
+                }
+            }
+            std::unique_ptr<Node> node = leaf(Opcode::PARAMETER);
+            node->index = index;
+            parameter_count_ = std::max(parameter_count_, node->index + 1);
+            return node;
+        }
+
+        Opcode op;
+        if (name == "exp") {
+            op = Opcode::EXP;
+        } else if (name == "log") {
+            op = Opcode::LOG;
+        } else if (name == "sqrt") {
+            op = Opcode::SQRT;
+        } else if (name == "sin") {
+            op = Opcode::SIN;
+        } else if (name == "cos") {
+            op = Opcode::COS;
+        } else if (name == "tan") {
+            op = Opcode::TAN;
+        } else {
+            position_ = start;
+            fail("unknown name '" + name + "'");
+        }
+        if (!accept("(")) {
+            fail("expected '(' after " + name);
+        }
+        std::unique_ptr<Node> argument = parse_sum();
+        if (!accept(")")) {
+            fail("expected ')'");
+        }
+        return make(op, std::move(argument), nullptr, 0);
+    }
+
+    const std::string& text_;
+    std::size_t position_ = 0;
+    int parameter_count_ = 0;
+    int depth_ = 0;
+};
+
+/**
+ * @brief Emit instructions leaving the value of root in register 0. A node
+ * in register depth evaluates its first operand into the same register and
+ * its second into the one above. The tree is walked with an explicit stack,
+ * since long operator chains make it arbitrarily deep.
+ *
+ * @param root Syntax tree.
+ * @param program Destination program.
+ * @param registers Running register count.
+ */
+void emit(const Node& root, std::vector<Instruction>& program, int& registers){
+    struct Frame {
+        const Node* node;
+        int depth;
+        int visited;
+    };
+    std::vector<Frame> stack;
+    stack.push_back({&root, 0, 0});
+
+    while (!stack.empty()) {
+        Frame& frame = stack.back();
+        const Node& node = *frame.node;
+        const int depth = frame.depth;
+        if (depth >= CompiledExpression::MAX_REGISTERS) {
+            throw std::invalid_argument("Expression is nested too deeply to compile");
+        }
+        registers = std::max(registers, depth + 1);
+        const unsigned char dst = static_cast<unsigned char>(depth);
+
+        if (!node.lhs) {
+            program.push_back({node.op, dst, 0, 0, node.index, node.constant});
+            stack.pop_back();
+        } else if (frame.visited == 0) {
+            frame.visited = 1;
+            stack.push_back({node.lhs.get(), depth, 0});
+        } else if (frame.visited == 1 && !is_unary(node.op)) {
+            frame.visited = 2;
+            stack.push_back({node.rhs.get(), depth + 1, 0});
+        } else {
+            const unsigned char rhs = is_unary(node.op) ? dst : static_cast<unsigned char>(depth + 1);
+            program.push_back({node.op, dst, dst, rhs, node.index, 0.0});
+            stack.pop_back();
+        }
+    }
+}
+
+}  // namespace
+
+/**
+ * @brief Parse and compile an expression.
+ *
+ * @param source Expression text, e.g. "x**3 + 4*x**2 - 10".
+ */
+CompiledExpression::CompiledExpression(const std::string& source) : source_(source) {
+    Parser parser{source_};
+    const std::unique_ptr<Node> root = parser.parse();
+    parameter_count_ = parser.parameter_count();
+    emit(*root, program_, register_count_);
+}
+
+/**
+ * @brief Check that enough parameters were supplied.
+ *
+ * @param params Parameter values.
+ */
+void CompiledExpression::check_parameters(const std::vector<double>& params) const {
+    if (static_cast<int>(params.size()) < parameter_count_) {
+        throw std::invalid_argument(
+            "Expression expects " + std::to_string(parameter_count_) + " parameters"
+        );
+    }
+}
+
+/**
+ * @brief Evaluate f at x without parameters.
+ *
+ * @param x Point of evaluation.
+ * @return f(x).
+ */
+double CompiledExpression::operator()(double x) const {
+    static const std::vector<double> no_parameters;
+    return evaluate(x, no_parameters);
+}
+
+/**
+ * @brief Evaluate f at x.
+ *
+ * @param x Point of evaluation.
+ * @param params Parameter values p0, p1, ...
+ * @return f(x; p).
+ */
+double CompiledExpression::evaluate(double x, const std::vector<double>& params) const {
+    check_parameters(params);
+    double r[MAX_REGISTERS];
+
+    for (const Instruction& ins : program_) {
+        switch (ins.op) {
+            case Opcode::CONSTANT:
+                r[ins.dst] = ins.constant;
+                break;
+            case Opcode::VARIABLE:
+                r[ins.dst] = x;
+                break;
+            case Opcode::PARAMETER:
+                r[ins.dst] = params[ins.index];
+                break;
+            default:
+                r[ins.dst] = apply(ins.op, r[ins.lhs], r[ins.rhs], ins.index);
+                break;
+        }
+    }
+    return r[0];
+}
+
+/**
+ * @brief Evaluate f and df/dx at x by replaying the program on dual numbers.
+ *
+ * @param x Point of evaluation.
+ * @param params Parameter values p0, p1, ...
+ * @return Tuple of f(x; p) and df/dx(x; p).
+ */
+std::tuple<double, double> CompiledExpression::evaluate_derivative(double x, const std::vector<double>& params) const {
+    check_parameters(params);
+    double r[MAX_REGISTERS];
+    double d[MAX_REGISTERS];
+
+    for (const Instruction& ins : program_) {
+        if (ins.op == Opcode::CONSTANT) {
+            r[ins.dst] = ins.constant;
+            d[ins.dst] = 0.0;
+            continue;
+        }
+        if (ins.op == Opcode::VARIABLE) {
+            r[ins.dst] = x;
+            d[ins.dst] = 1.0;
+            continue;
+        }
+        if (ins.op == Opcode::PARAMETER) {
+            r[ins.dst] = params[ins.index];
+            d[ins.dst] = 0.0;
+            continue;
+        }
+
+        const double a = r[ins.lhs];
+        const double da = d[ins.lhs];
+        const double b = r[ins.rhs];
+        const double db = d[ins.rhs];
+        double value, derivative;
+
+        switch (ins.op) {
+            case Opcode::ADD:
+                value = a + b;
+                derivative = da + db;
+                break;
+            case Opcode::SUBTRACT:
+                value = a - b;
+                derivative = da - db;
+                break;
+            case Opcode::MULTIPLY:
+                value = a * b;
+                derivative = da * b + a * db;
+                break;
+            case Opcode::DIVIDE:
+                value = a / b;
+                derivative = (da - value * db) / b;
+                break;
+            case Opcode::NEGATE:
+                value = -a;
+                derivative = -da;
+                break;
+            case Opcode::POWER_INT:
+                value = apply(Opcode::POWER_INT, a, 0.0, ins.index);
+                derivative = ins.index == 0 ? 0.0 : ins.index * apply(Opcode::POWER_INT, a, 0.0, ins.index - 1) * da;
+                break;
+            case Opcode::POWER:
+                value = std::pow(a, b);
+                derivative = b * std::pow(a, b - 1.0) * da;
+                if (db != 0.0) {
+                    derivative += value * std::log(a) * db;
+                }
+                break;
+            case Opcode::EXP:
+                value = std::exp(a);
+                derivative = value * da;
+                break;
+            case Opcode::LOG:
+                value = std::log(a);
+                derivative = da / a;
+                break;
+            case Opcode::SQRT:
+                value = std::sqrt(a);
+                derivative = da / (2.0 * value);
+                break;
+            case Opcode::SIN:
+                value = std::sin(a);
+                derivative = std::cos(a) * da;
+                break;
+            case Opcode::COS:
+                value = std::cos(a);
+                derivative = -std::sin(a) * da;
+                break;
+            case Opcode::TAN:
+                value = std::tan(a);
+                derivative = (1.0 + value * value) * da;
+                break;
+            default:
+                throw std::logic_error("Unknown opcode");
+        }
+        r[ins.dst] = value;
+        d[ins.dst] = derivative;
+    }
+    return std::make_tuple(r[0], d[0]);
+}
+
+/**
+ * @brief Evaluate f on n lanes, one block of LANE_BLOCK lanes at a time, with
+ * the instruction loop outside and a dense loop over the block's lanes
+ * inside.
+ *
+ * @param x Points of evaluation, one per lane.
+ * @param params Parameter values of each lane.
+ * @param f Receives f(x[i]; params[i]).
+ * @param n Number of lanes.
+ */
+void CompiledExpression::evaluate_lanes(const double* x, const double* const* params, double* f, int n) const {
+    double r[MAX_REGISTERS][LANE_BLOCK];
+
+    for (int start = 0; start < n; start += LANE_BLOCK) {
+        const int width = std::min(LANE_BLOCK, n - start);
+        const double* xs = x + start;
+        const double* const* ps = params + start;
+
+        for (const Instruction& ins : program_) {
+            double* dst = r[ins.dst];
+            const double* a = r[ins.lhs];
+            const double* b = r[ins.rhs];
+            switch (ins.op) {
+                case Opcode::CONSTANT:
+                    for (int ii = 0; ii < width; ii++) {
+                        dst[ii] = ins.constant;
+                    }
+                    break;
+                case Opcode::VARIABLE:
+                    for (int ii = 0; ii < width; ii++) {
+                        dst[ii] = xs[ii];
+                    }
+                    break;
+                case Opcode::PARAMETER:
+                    for (int ii = 0; ii < width; ii++) {
+                        dst[ii] = ps[ii][ins.index];
+                    }
+                    break;
+                case Opcode::ADD:
+                    for (int ii = 0; ii < width; ii++) {
+                        dst[ii] = a[ii] + b[ii];
+                    }
+                    break;
+                case Opcode::SUBTRACT:
+                    for (int ii = 0; ii < width; ii++) {
+                        dst[ii] = a[ii] - b[ii];
+                    }
+                    break;
+                case Opcode::MULTIPLY:
+                    for (int ii = 0; ii < width; ii++) {
+                        dst[ii] = a[ii] * b[ii];
+                    }
+                    break;
+                case Opcode::DIVIDE:
+                    for (int ii = 0; ii < width; ii++) {
+                        dst[ii] = a[ii] / b[ii];
+                    }
+                    break;
+                case Opcode::NEGATE:
+                    for (int ii = 0; ii < width; ii++) {
+                        dst[ii] = -a[ii];
+                    }
+                    break;
+                default:
+                    for (int ii = 0; ii < width; ii++) {
+                        dst[ii] = apply(ins.op, a[ii], b[ii], ins.index);
+                    }
+                    break;
+            }
+        }
+        for (int ii = 0; ii < width; ii++) {
+            f[start + ii] = r[0][ii];
+        }
+    }
+}
+
+/**
+ * @brief Evaluate f and df/dx on n lanes by replaying the program on dual
+ * numbers, one block of LANE_BLOCK lanes at a time, with the instruction loop
+ * outside and a dense loop over the block's lanes inside.
+ *
+ * @param x Points of evaluation, one per lane.
+ * @param params Parameter values of each lane.
+ * @param f Receives f(x[i]; params[i]).
+ * @param df Receives df/dx(x[i]; params[i]).
+ * @param n Number of lanes.
+ */
+void CompiledExpression::evaluate_derivative_lanes(const double* x, const double* const* params, double* f, double* df, int n) const {
+    double r[MAX_REGISTERS][LANE_BLOCK];
+    double d[MAX_REGISTERS][LANE_BLOCK];
+
+    for (int start = 0; start < n; start += LANE_BLOCK) {
+        const int width = std::min(LANE_BLOCK, n - start);
+        const double* xs = x + start;
+        const double* const* ps = params + start;
+
+        for (const Instruction& ins : program_) {
+            double* value = r[ins.dst];
+            double* derivative = d[ins.dst];
+            const double* a = r[ins.lhs];
+            const double* da = d[ins.lhs];
+            const double* b = r[ins.rhs];
+            const double* db = d[ins.rhs];
+            switch (ins.op) {
+                case Opcode::CONSTANT:
+                    for (int ii = 0; ii < width; ii++) {
+                        value[ii] = ins.constant;
+                        derivative[ii] = 0.0;
+                    }
+                    break;
+                case Opcode::VARIABLE:
+                    for (int ii = 0; ii < width; ii++) {
+                        value[ii] = xs[ii];
+                        derivative[ii] = 1.0;
+                    }
+                    break;
+                case Opcode::PARAMETER:
+                    for (int ii = 0; ii < width; ii++) {
+                        value[ii] = ps[ii][ins.index];
+                        derivative[ii] = 0.0;
+                    }
+                    break;
+                case Opcode::ADD:
+                    for (int ii = 0; ii < width; ii++) {
+                        value[ii] = a[ii] + b[ii];
+                        derivative[ii] = da[ii] + db[ii];
+                    }
+                    break;
+                case Opcode::SUBTRACT:
+                    for (int ii = 0; ii < width; ii++) {
+                        value[ii] = a[ii] - b[ii];
+                        derivative[ii] = da[ii] - db[ii];
+                    }
+                    break;
+                case Opcode::MULTIPLY:
+                    // value and a or b may share a register, so the derivative
+                    // is formed from the operands before value is written.
+                    for (int ii = 0; ii < width; ii++) {
+                        const double product = a[ii] * b[ii];
+                        derivative[ii] = da[ii] * b[ii] + a[ii] * db[ii];
+                        value[ii] = product;
+                    }
+                    break;
+                case Opcode::DIVIDE:
+                    for (int ii = 0; ii < width; ii++) {
+                        const double quotient = a[ii] / b[ii];
+                        derivative[ii] = (da[ii] - quotient * db[ii]) / b[ii];
+                        value[ii] = quotient;
+                    }
+                    break;
+                case Opcode::NEGATE:
+                    for (int ii = 0; ii < width; ii++) {
+                        value[ii] = -a[ii];
+                        derivative[ii] = -da[ii];
+                    }
+                    break;
+                case Opcode::POWER_INT:
+                    for (int ii = 0; ii < width; ii++) {
+                        const double slope = ins.index == 0 ? 0.0 : ins.index * apply(Opcode::POWER_INT, a[ii], 0.0, ins.index - 1);
+                        derivative[ii] = slope * da[ii];
+                        value[ii] = apply(Opcode::POWER_INT, a[ii], 0.0, ins.index);
+                    }
+                    break;
+                case Opcode::POWER:
+                    for (int ii = 0; ii < width; ii++) {
+                        const double power = std::pow(a[ii], b[ii]);
+                        double slope = b[ii] * std::pow(a[ii], b[ii] - 1.0) * da[ii];
+                        if (db[ii] != 0.0) {
+                            slope += power * std::log(a[ii]) * db[ii];
+                        }
+                        derivative[ii] = slope;
+                        value[ii] = power;
+                    }
+                    break;
+                case Opcode::EXP:
+                    for (int ii = 0; ii < width; ii++) {
+                        const double exponential = std::exp(a[ii]);
+                        derivative[ii] = exponential * da[ii];
+                        value[ii] = exponential;
+                    }
+                    break;
+                case Opcode::LOG:
+                    for (int ii = 0; ii < width; ii++) {
+                        derivative[ii] = da[ii] / a[ii];
+                        value[ii] = std::log(a[ii]);
+                    }
+                    break;
+                case Opcode::SQRT:
+                    for (int ii = 0; ii < width; ii++) {
+                        const double root = std::sqrt(a[ii]);
+                        derivative[ii] = da[ii] / (2.0 * root);
+                        value[ii] = root;
+                    }
+                    break;
+                case Opcode::SIN:
+                    for (int ii = 0; ii < width; ii++) {
+                        derivative[ii] = std::cos(a[ii]) * da[ii];
+                        value[ii] = std::sin(a[ii]);
+                    }
+                    break;
+                case Opcode::COS:
+                    for (int ii = 0; ii < width; ii++) {
+                        derivative[ii] = -std::sin(a[ii]) * da[ii];
+                        value[ii] = std::cos(a[ii]);
+                    }
+                    break;
+                case Opcode::TAN:
+                    for (int ii = 0; ii < width; ii++) {
+                        const double tangent = std::tan(a[ii]);
+                        derivative[ii] = (1.0 + tangent * tangent) * da[ii];
+                        value[ii] = tangent;
+                    }
+                    break;
+                default:
+                    throw std::logic_error("Unknown opcode");
+            }
+        }
+        for (int ii = 0; ii < width; ii++) {
+            f[start + ii] = r[0][ii];
+            df[start + ii] = d[0][ii];
+        }
+    }
+}
+
+/**
+ * @brief Expression text the program was compiled from.
+ *
+ * @return Source string.
+ */
+const std::string& CompiledExpression::source() const {
+    return source_;
+}
+
+/**
+ * @brief Number of parameters referenced, one more than the largest index.
+ *
+ * @return Parameter count.
+ */
+int CompiledExpression::parameter_count() const {
+    return parameter_count_;
+}
+
+/**
+ * @brief Number of registers used by the program.
+ *
+ * @return Register count.
+ */
+int CompiledExpression::register_count() const {
+    return register_count_;
+}
+
+/**
+ * @brief Compiled program.
+ *
+ * @return Instructions in execution order.
+ */
+const std::vector<Instruction>& CompiledExpression::instructions() const {
+    return program_;
+}
+
+/**
+ * @brief Solve f(x; p_k) = 0 for many parameter sets with the Newton-Raphson
+ * method, using the derivative tape for f' and a thread pool across solves.
+ *
+ * @param func Compiled expression f(x; p).
+ * @param x0 Initial approximations, one per solve.
+ * @param params Parameter sets: empty, one shared set, or one set per solve.
+ * @param MAX_ITERS Maximum number of iterations per solve.
+ * @param TOL Convergence tolerance.
+ * @param num_threads Number of worker threads; values <= 0 use all cores.
+ * @return Approximate roots, one per solve.
+ */
+std::vector<double> newton_method_batch(
+    const CompiledExpression& func,
+    const std::vector<double>& x0,
+    const std::vector<std::vector<double>>& params,
+    int MAX_ITERS,
+    double TOL,
+    int num_threads
+){
+    if (params.size() > 1 && params.size() != x0.size()) {
+        throw std::invalid_argument("Batch expects no parameter sets, one, or one per initial approximation");
+    }
+    const std::vector<double> no_parameters;
+    std::vector<double> roots;
+    roots.assign(x0.size(), 0.0);
+
+    ThreadPool pool{num_threads};
+    parallel_for(pool, 0, static_cast<int>(x0.size()), [&](int kk) {
+        const std::vector<double>& p = params.empty() ? no_parameters : params[params.size() == 1 ? 0 : kk];
+        const auto f_df = [&func, &p](double x) { return func.evaluate_derivative(x, p); };
+        roots[kk] = newton_method(f_df, x0[kk], MAX_ITERS, TOL);
+    });
+    return roots;
+}
+
+/**
+ * @brief Solve f(x; p_k) = 0 for many parameter sets with the Newton-Raphson
+ * method under solve options.
+ *
+ * @param func Compiled expression f(x; p).
+ * @param x0 Initial approximations, one per solve.
+ * @param params Parameter sets: empty, one shared set, or one set per solve.
+ * @param options Iteration, tolerance and resource limits.
+ * @param num_threads Number of worker threads; values <= 0 use all cores.
+ * @return Solve results, one per solve.
+ */
+std::vector<SolveResult> newton_method_batch(
+    const CompiledExpression& func,
+    const std::vector<double>& x0,
+    const std::vector<std::vector<double>>& params,
+    const SolveOptions& options,
+    int num_threads
+){
+    if (params.size() > 1 && params.size() != x0.size()) {
+        throw std::invalid_argument("Batch expects no parameter sets, one, or one per initial approximation");
+    }
+    const std::vector<double> no_parameters;
+    std::vector<SolveResult> results;
+    results.resize(x0.size());
+
+    ThreadPool pool{num_threads};
+    parallel_for(pool, 0, static_cast<int>(x0.size()), [&](int kk) {
+        const std::vector<double>& p = params.empty() ? no_parameters : params[params.size() == 1 ? 0 : kk];
+        const auto f_df = [&func, &p](double x) { return func.evaluate_derivative(x, p); };
+        results[kk] = newton_method(f_df, x0[kk], options);
+    });
+    return results;
+}
@@ -0,0 +1,66 @@
+#include <csignal>
+#include <exception>
+#include <iostream>
+#include <pthread.h>
+#include <string>
+#include <thread>
+#include "numeric/solver_service.hpp"
+
+/**
+ * @brief Run a SolverServer until SIGINT or SIGTERM.
+ *
+ * Usage: numeric-solverd SOCKET_PATH [NUM_THREADS]
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Command-line arguments.
+ * @return Exit status.
+ */
+int main(int argc, char* argv[]){
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " SOCKET_PATH [NUM_THREADS]" << std::endl;
+        return 2;
+    }
+    const std::string socket_path = argv[1];
+    int num_threads = 0;
+    try {
+        num_threads = argc == 3 ? std::stoi(argv[2]) : 0;
+    } catch (const std::exception&) {
+        std::cerr << "NUM_THREADS must be an integer" << std::endl;
+        return 2;
+    }
+
+    // Block the shutdown signals in every thread; a dedicated thread waits
+    // for them and stops the server.
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    try {
+        SolverServer server{socket_path, num_threads};
+        std::thread waiter{[&server, &signals] {
+            int received = 0;
+            sigwait(&signals, &received);
+            server.stop();
+        }};
+        std::cerr << "numeric-solverd listening on " << socket_path << std::endl;
+        std::exception_ptr error;
+        try {
+            server.run();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // Wake the waiter if run() returned for a reason other than a signal.
+        pthread_kill(waiter.native_handle(), SIGTERM);
+        waiter.join();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        std::cerr << "numeric-solverd solved " << server.records_solved() << " records" << std::endl;
+    } catch (const std::exception& exception) {
+        std::cerr << "numeric-solverd: " << exception.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "numeric/differentiation.hpp"
+
+/**
+ * @brief Step size balancing truncation and rounding error for a centered
+ * difference of the given order, h = eps^(1 / (order + 1)) * max(1, |x|).
+ *
+ * @param x Point at which the derivative is evaluated.
+ * @param order Order of accuracy of the difference formula.
+ * @return Step size h.
+ */
+double optimal_step(double x, int order){
+    if (order < 1) {
+        throw std::invalid_argument("optimal_step expects a positive order");
+    }
+    const double eps = std::numeric_limits<double>::epsilon();
+    return std::pow(eps, 1.0 / (order + 1)) * std::max(1.0, std::abs(x));
+}
+
+/**
+ * @brief Approximate f'(x) using the complex-step formula Im(f(x + ih)) / h.
+ *
+ * @param func Analytic function f(z) accepting complex arguments.
+ * @param x Point at which the derivative is evaluated.
+ * @param h Imaginary step size, e.g. 1e-20.
+ * @return Approximate first derivative of f at x.
+ */
+double complex_step_derivative(
+    const std::function<std::complex<double>(std::complex<double>)>& func,
+    double x,
+    double h
+){
+    if (h == 0.0) {
+        throw std::invalid_argument("Complex step expects a non-zero step size");
+    }
+    return func(std::complex<double>(x, h)).imag() / h;
+}
+
+/**
+ * @brief Approximate f'(x) using a centered difference stencil of order 2, 4
+ * or 6.
+ *
+ * @param func Continuous function f(x).
+ * @param x Point at which the derivative is evaluated.
+ * @param h Step size.
+ * @param order Order of accuracy: 2, 4 or 6.
+ * @return Approximate first derivative of f at x.
+ */
+double centered_difference(
+    const std::function<double(double)>& func,
+    double x,
+    double h,
+    int order
+){
+    if (h == 0.0) {
+        throw std::invalid_argument("Centered difference expects a non-zero step size");
+    }
+
+    switch (order) {
+        case 2:
+            return (func(x + h) - func(x - h)) / (2 * h);
+        case 4:
+            return (func(x - 2 * h) - 8 * func(x - h) + 8 * func(x + h) - func(x + 2 * h))
+                / (12 * h);
+        case 6:
+            return (-func(x - 3 * h) + 9 * func(x - 2 * h) - 45 * func(x - h)
+                    + 45 * func(x + h) - 9 * func(x + 2 * h) + func(x + 3 * h))
+                / (60 * h);
+        default:
+            throw std::invalid_argument("Centered difference supports orders 2, 4 and 6");
+    }
+}
+
+/**
+ * @brief Approximate f'(x) by Richardson extrapolation of centered differences
+ * with steps h, h/2, h/4, ... Section 4.2 in "Numerical Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param x Point at which the derivative is evaluated.
+ * @param h Initial (largest) step size.
+ * @param MAX_LEVELS Maximum number of rows in the extrapolation table.
+ * @param TOL Target error estimate.
+ * @return Approximate first derivative of f at x.
+ */
+double richardson_derivative(
+    const std::function<double(double)>& func,
+    double x,
+    double h,
+    int MAX_LEVELS,
+    double TOL
+){
+    if (h == 0.0) {
+        throw std::invalid_argument("Richardson extrapolation expects a non-zero step size");
+    }
+    if (MAX_LEVELS < 1) {
+        throw std::invalid_argument("Richardson extrapolation expects at least one level");
+    }
+
+    // N[i * MAX_LEVELS + j] holds N_(j+1)(h / 2^i).
+    std::vector<double> N;
+    N.assign(MAX_LEVELS * MAX_LEVELS, 0.0);
+
+    // Step 1
+    N[0] = centered_difference(func, x, h, 2);
+    double best = N[0];
+    double error = std::numeric_limits<double>::infinity();
+
+    // Step 2
+    for (int ii = 1; ii < MAX_LEVELS; ii++) {
+        // Step 3
+        h *= 0.5;
+        N[ii * MAX_LEVELS] = centered_difference(func, x, h, 2);
+
+        // Step 4
+        double factor = 4.0;
+        for (int jj = 1; jj <= ii; jj++) {
+            const double current = N[ii * MAX_LEVELS + jj - 1];
+            const double previous = N[(ii - 1) * MAX_LEVELS + jj - 1];
+            N[ii * MAX_LEVELS + jj] = current + (current - previous) / (factor - 1.0);
+            factor *= 4.0;
+
+            const double estimate = std::max(
+                std::abs(N[ii * MAX_LEVELS + jj] - current),
+                std::abs(N[ii * MAX_LEVELS + jj] - previous)
+            );
+            if (estimate <= error) {
+                error = estimate;
+                best = N[ii * MAX_LEVELS + jj];
+            }
+        }
+
+        // Step 5
+        if (error < TOL) {
+            break;
+        }
+
+        // Step 6
+        const double diagonal_change = std::abs(
+            N[ii * MAX_LEVELS + ii] - N[(ii - 1) * MAX_LEVELS + ii - 1]
+        );
+        if (diagonal_change >= 2 * error) {
+            break;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Approximate f' at each point of x with a centered difference of the
+ * given order, using optimal_step for every point.
+ *
+ * @param func Continuous function f(x).
+ * @param x Points at which the derivative is evaluated.
+ * @param order Order of accuracy: 2, 4 or 6.
+ * @return Approximate first derivatives, one per point.
+ */
+std::vector<double> centered_difference_batch(
+    const std::function<double(double)>& func,
+    const std::vector<double>& x,
+    int order
+){
+    std::vector<double> derivatives;
+    derivatives.reserve(x.size());
+    for (double point : x) {
+        derivatives.push_back(centered_difference(func, point, optimal_step(point, order), order));
+    }
+    return derivatives;
+}
+
+/**
+ * @brief Approximate f' at each point of x with the complex-step formula.
+ *
+ * @param func Analytic function f(z) accepting complex arguments.
+ * @param x Points at which the derivative is evaluated.
+ * @param h Imaginary step size, e.g. 1e-20.
+ * @return Approximate first derivatives, one per point.
+ */
+std::vector<double> complex_step_derivative_batch(
+    const std::function<std::complex<double>(std::complex<double>)>& func,
+    const std::vector<double>& x,
+    double h
+){
+    std::vector<double> derivatives;
+    derivatives.reserve(x.size());
+    for (double point : x) {
+        derivatives.push_back(complex_step_derivative(func, point, h));
+    }
+    return derivatives;
+}
@@ -0,0 +1,311 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "numeric/interval.hpp"
+
+namespace {
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+constexpr double TWO_PI = 6.283185307179586;
+
+/**
+ * @brief Round a value one ulp toward -inf.
+ *
+ * @param x Value rounded to nearest.
+ * @return Lower bound for the exact value.
+ */
+double down(double x){
+    return std::nextafter(x, -INF);
+}
+
+/**
+ * @brief Round a value one ulp toward +inf.
+ *
+ * @param x Value rounded to nearest.
+ * @return Upper bound for the exact value.
+ */
+double up(double x){
+    return std::nextafter(x, INF);
+}
+
+/**
+ * @brief Widen a library function result to an enclosure, allowing for the
+ * last-bit error of libm in addition to the rounding of the result.
+ *
+ * @param lower Lower value from libm.
+ * @param upper Upper value from libm.
+ * @return Enclosure [lower - 2 ulp, upper + 2 ulp].
+ */
+Interval widen(double lower, double upper){
+    return Interval(down(down(lower)), up(up(upper)));
+}
+
+/**
+ * @brief Whether [lower, upper] contains a point offset + 2 k pi for some
+ * integer k, erring on the side of true.
+ *
+ * @param lower Left endpoint.
+ * @param upper Right endpoint.
+ * @param offset Phase of the periodic points.
+ * @return Whether such a point may lie in the interval.
+ */
+bool contains_periodic_point(double lower, double upper, double offset){
+    const double slack = 1e-15 * std::max(1.0, std::max(std::abs(lower), std::abs(upper)));
+    const double k_min = std::ceil((lower - slack - offset) / TWO_PI);
+    const double k_max = std::floor((upper + slack - offset) / TWO_PI);
+    return k_min <= k_max;
+}
+
+}  // namespace
+
+/**
+ * @brief Construct the degenerate interval [value, value].
+ *
+ * @param value Point value.
+ */
+Interval::Interval(double value) : lower(value), upper(value) {}
+
+/**
+ * @brief Construct the interval [lower, upper].
+ *
+ * @param lower Left endpoint.
+ * @param upper Right endpoint, upper >= lower.
+ */
+Interval::Interval(double lower, double upper) : lower(lower), upper(upper) {
+    if (!(lower <= upper)) {
+        throw std::invalid_argument("Interval expects lower <= upper");
+    }
+}
+
+/**
+ * @brief Midpoint of the interval.
+ *
+ * @return (lower + upper) / 2.
+ */
+double Interval::midpoint() const {
+    return lower + 0.5 * (upper - lower);
+}
+
+/**
+ * @brief Width of the interval.
+ *
+ * @return upper - lower.
+ */
+double Interval::width() const {
+    return upper - lower;
+}
+
+/**
+ * @brief Whether x lies in the interval.
+ *
+ * @param x Point.
+ * @return lower <= x <= upper.
+ */
+bool Interval::contains(double x) const {
+    return lower <= x && x <= upper;
+}
+
+/**
+ * @brief Whether other lies strictly inside the interval.
+ *
+ * @param other Interval.
+ * @return lower < other.lower and other.upper < upper.
+ */
+bool Interval::interior_contains(const Interval& other) const {
+    return lower < other.lower && other.upper < upper;
+}
+
+/**
+ * @brief Intersect two intervals.
+ *
+ * @param a First interval.
+ * @param b Second interval.
+ * @param out Destination for a intersected with b when non-empty.
+ * @return Whether the intersection is non-empty.
+ */
+bool intersect(const Interval& a, const Interval& b, Interval& out){
+    const double lower = std::max(a.lower, b.lower);
+    const double upper = std::min(a.upper, b.upper);
+    if (lower > upper) {
+        return false;
+    }
+    out = Interval(lower, upper);
+    return true;
+}
+
+/**
+ * @brief Negate an interval.
+ *
+ * @param a Interval.
+ * @return -a.
+ */
+Interval operator-(const Interval& a){
+    return Interval(-a.upper, -a.lower);
+}
+
+/**
+ * @brief Add two intervals.
+ *
+ * @param a Left operand.
+ * @param b Right operand.
+ * @return Enclosure of a + b.
+ */
+Interval operator+(const Interval& a, const Interval& b){
+    return Interval(down(a.lower + b.lower), up(a.upper + b.upper));
+}
+
+/**
+ * @brief Subtract two intervals.
+ *
+ * @param a Left operand.
+ * @param b Right operand.
+ * @return Enclosure of a - b.
+ */
+Interval operator-(const Interval& a, const Interval& b){
+    return Interval(down(a.lower - b.upper), up(a.upper - b.lower));
+}
+
+/**
+ * @brief Multiply two intervals.
+ *
+ * @param a Left operand.
+ * @param b Right operand.
+ * @return Enclosure of a * b.
+ */
+Interval operator*(const Interval& a, const Interval& b){
+    const double p1 = a.lower * b.lower;
+    const double p2 = a.lower * b.upper;
+    const double p3 = a.upper * b.lower;
+    const double p4 = a.upper * b.upper;
+    return Interval(
+        down(std::min(std::min(p1, p2), std::min(p3, p4))),
+        up(std::max(std::max(p1, p2), std::max(p3, p4)))
+    );
+}
+
+/**
+ * @brief Divide two intervals. Throws std::domain_error if b contains zero.
+ *
+ * @param a Numerator.
+ * @param b Denominator.
+ * @return Enclosure of a / b.
+ */
+Interval operator/(const Interval& a, const Interval& b){
+    if (b.contains(0.0)) {
+        throw std::domain_error("Interval division by an interval containing zero");
+    }
+    const double q1 = a.lower / b.lower;
+    const double q2 = a.lower / b.upper;
+    const double q3 = a.upper / b.lower;
+    const double q4 = a.upper / b.upper;
+    return Interval(
+        down(std::min(std::min(q1, q2), std::min(q3, q4))),
+        up(std::max(std::max(q1, q2), std::max(q3, q4)))
+    );
+}
+
+/**
+ * @brief Raise an interval to an integer power.
+ *
+ * @param a Interval.
+ * @param p Integer exponent.
+ * @return Enclosure of a^p.
+ */
+Interval pow(const Interval& a, int p){
+    if (p == 0) {
+        return Interval(1.0);
+    }
+    if (p < 0) {
+        return Interval(1.0) / pow(a, -p);
+    }
+    if (p % 2 == 1 || a.lower >= 0.0) {
+        return widen(std::pow(a.lower, p), std::pow(a.upper, p));
+    }
+    if (a.upper <= 0.0) {
+        return widen(std::pow(a.upper, p), std::pow(a.lower, p));
+    }
+    const Interval result = widen(0.0, std::pow(std::max(-a.lower, a.upper), p));
+    return Interval(0.0, result.upper);
+}
+
+/**
+ * @brief Exponential of an interval.
+ *
+ * @param a Interval.
+ * @return Enclosure of exp(a).
+ */
+Interval exp(const Interval& a){
+    const Interval result = widen(std::exp(a.lower), std::exp(a.upper));
+    return Interval(std::max(0.0, result.lower), result.upper);
+}
+
+/**
+ * @brief Natural logarithm of an interval. Throws std::domain_error unless
+ * a.lower > 0.
+ *
+ * @param a Interval.
+ * @return Enclosure of log(a).
+ */
+Interval log(const Interval& a){
+    if (a.lower <= 0.0) {
+        throw std::domain_error("Interval logarithm requires a positive interval");
+    }
+    return widen(std::log(a.lower), std::log(a.upper));
+}
+
+/**
+ * @brief Square root of an interval. Throws std::domain_error if a.lower < 0.
+ *
+ * @param a Interval.
+ * @return Enclosure of sqrt(a).
+ */
+Interval sqrt(const Interval& a){
+    if (a.lower < 0.0) {
+        throw std::domain_error("Interval square root requires a non-negative interval");
+    }
+    const Interval result = widen(std::sqrt(a.lower), std::sqrt(a.upper));
+    return Interval(std::max(0.0, result.lower), result.upper);
+}
+
+/**
+ * @brief Sine of an interval.
+ *
+ * @param a Interval.
+ * @return Enclosure of sin(a).
+ */
+Interval sin(const Interval& a){
+    if (a.width() >= TWO_PI) {
+        return Interval(-1.0, 1.0);
+    }
+    const double s_lower = std::sin(a.lower);
+    const double s_upper = std::sin(a.upper);
+    const Interval result = widen(std::min(s_lower, s_upper), std::max(s_lower, s_upper));
+
+    const double lower = contains_periodic_point(a.lower, a.upper, -0.25 * TWO_PI)
+        ? -1.0 : std::max(-1.0, result.lower);
+    const double upper = contains_periodic_point(a.lower, a.upper, 0.25 * TWO_PI)
+        ? 1.0 : std::min(1.0, result.upper);
+    return Interval(lower, upper);
+}
+
+/**
+ * @brief Cosine of an interval.
+ *
+ * @param a Interval.
+ * @return Enclosure of cos(a).
+ */
+Interval cos(const Interval& a){
+    if (a.width() >= TWO_PI) {
+        return Interval(-1.0, 1.0);
+    }
+    const double c_lower = std::cos(a.lower);
+    const double c_upper = std::cos(a.upper);
+    const Interval result = widen(std::min(c_lower, c_upper), std::max(c_lower, c_upper));
+
+    const double lower = contains_periodic_point(a.lower, a.upper, 0.5 * TWO_PI)
+        ? -1.0 : std::max(-1.0, result.lower);
+    const double upper = contains_periodic_point(a.lower, a.upper, 0.0)
+        ? 1.0 : std::min(1.0, result.upper);
+    return Interval(lower, upper);
+}
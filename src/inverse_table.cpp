@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include "numeric/chebyshev.hpp"
+#include "numeric/inverse_table.hpp"
+#include "numeric/thread_pool.hpp"
+
+namespace {
+
+/**
+ * @brief Piece of the range of f awaiting a Chebyshev fit, with a bracket
+ * [x_lower, x_upper] known to contain its preimage.
+ */
+struct PendingPiece {
+    double y_lower;
+    double y_upper;
+    double x_lower;
+    double x_upper;
+    int depth;
+};
+
+/**
+ * @brief Solve f(x) = y for monotone f by bisection on a bracket, continuing
+ * until the bracket cannot be halved in floating point.
+ *
+ * @param func Monotone function f(x).
+ * @param y Target value.
+ * @param a One end of the bracket.
+ * @param b Other end of the bracket.
+ * @param increasing Whether f is increasing.
+ * @return Approximate x with f(x) = y.
+ */
+double invert_point(const std::function<double(double)>& func, double y, double a, double b, bool increasing){
+    if (a > b) {
+        std::swap(a, b);
+    }
+    for (int iteration = 0; iteration < 2100; iteration++) {
+        const double x = a + 0.5 * (b - a);
+        if (x <= a || x >= b) {
+            return x;
+        }
+        const double residual = func(x) - y;
+        if (residual == 0.0) {
+            return x;
+        }
+        if ((residual < 0.0) == increasing) {
+            a = x;
+        } else {
+            b = x;
+        }
+    }
+    return a + 0.5 * (b - a);
+}
+
+}  // namespace
+
+/**
+ * @brief Build the inverse table.
+ *
+ * @param func Continuous, strictly monotone function f(x); must be
+ * thread-safe.
+ * @param a Left endpoint of the domain.
+ * @param b Right endpoint of the domain.
+ * @param degree Chebyshev degree of every piece.
+ * @param TOL Absolute tolerance on x for the trailing coefficients.
+ * @param num_threads Number of worker threads; values <= 0 use all cores.
+ */
+InverseTable::InverseTable(
+    const std::function<double(double)>& func,
+    double a,
+    double b,
+    int degree,
+    double TOL,
+    int num_threads
+) : func_(func), degree_(degree) {
+    if (!(a < b)) {
+        throw std::invalid_argument("Inverse table expects a < b");
+    }
+    if (degree < 2) {
+        throw std::invalid_argument("Inverse table expects degree >= 2");
+    }
+
+    // Step 1
+    const double f_a = func(a);
+    const double f_b = func(b);
+    if (!(f_a != f_b)) {
+        throw std::invalid_argument("Inverse table expects a strictly monotone function");
+    }
+    const bool increasing = f_b > f_a;
+    const int stride = degree + 3;
+    const int max_depth = 30;
+
+    ThreadPool pool{num_threads};
+    std::vector<PendingPiece> pending;
+    pending.push_back({std::min(f_a, f_b), std::max(f_a, f_b), a, b, 0});
+    std::vector<PendingPiece> accepted;
+    std::vector<std::vector<double>> accepted_coefs;
+
+    while (!pending.empty()) {
+        // Step 2: solve f(x) = y at every Chebyshev point of every pending piece.
+        const int count = static_cast<int>(pending.size());
+        std::vector<double> values;
+        values.assign(count * (degree + 1), 0.0);
+        parallel_for(pool, 0, count * (degree + 1), [&](int task) {
+            const PendingPiece& piece = pending[task / (degree + 1)];
+            const int jj = task % (degree + 1);
+            const double t = std::sin(M_PI * (degree - 2 * jj) / (2.0 * degree));
+            const double y = 0.5 * (piece.y_lower + piece.y_upper) + 0.5 * (piece.y_upper - piece.y_lower) * t;
+            values[task] = invert_point(func, y, piece.x_lower, piece.x_upper, increasing);
+        });
+
+        // Step 3: accept resolved pieces and split the others.
+        std::vector<PendingPiece> next;
+        for (int kk = 0; kk < count; kk++) {
+            const PendingPiece& piece = pending[kk];
+            const std::vector<double> coefs = chebyshev_coefficients(std::vector<double>(
+                values.begin() + kk * (degree + 1),
+                values.begin() + (kk + 1) * (degree + 1)
+            ));
+            const double tail = std::abs(coefs[degree]) + std::abs(coefs[degree - 1]);
+            if (tail <= TOL || piece.depth >= max_depth) {
+                accepted.push_back(piece);
+                accepted_coefs.push_back(coefs);
+                continue;
+            }
+            // The first and last Chebyshev points are y_upper and y_lower, and
+            // for even degree the middle one is y_middle, so the preimages
+            // already solved bound each child's bracket.
+            const double y_middle = 0.5 * (piece.y_lower + piece.y_upper);
+            const double x_upper = values[kk * (degree + 1)];
+            const double x_lower = values[kk * (degree + 1) + degree];
+            double x_middle = values[kk * (degree + 1) + degree / 2];
+            if (degree % 2 != 0) {
+                x_middle = invert_point(func, y_middle, x_lower, x_upper, increasing);
+            }
+            next.push_back({piece.y_lower, y_middle, x_lower, x_middle, piece.depth + 1});
+            next.push_back({y_middle, piece.y_upper, x_middle, x_upper, piece.depth + 1});
+        }
+        pending.swap(next);
+    }
+
+    // Step 4: store the pieces in order of y in one flat array.
+    std::vector<int> order;
+    for (int kk = 0; kk < static_cast<int>(accepted.size()); kk++) {
+        order.push_back(kk);
+    }
+    std::sort(order.begin(), order.end(), [&accepted](int lhs, int rhs) {
+        return accepted[lhs].y_lower < accepted[rhs].y_lower;
+    });
+
+    data_.reserve(accepted.size() * stride);
+    for (int kk : order) {
+        const PendingPiece& piece = accepted[kk];
+        breakpoints_.push_back(piece.y_lower);
+        data_.push_back(0.5 * (piece.y_lower + piece.y_upper));
+        data_.push_back(2.0 / (piece.y_upper - piece.y_lower));
+        data_.insert(data_.end(), accepted_coefs[kk].begin(), accepted_coefs[kk].end());
+    }
+    breakpoints_.push_back(accepted[order.back()].y_upper);
+}
+
+/**
+ * @brief Approximate x with f(x) = y.
+ *
+ * @param y Value in the range of f.
+ * @param polish Whether to apply one Newton step on f(x) - y.
+ * @return Approximate inverse at y.
+ */
+double InverseTable::evaluate(double y, bool polish) const {
+    if (!(y >= breakpoints_.front() && y <= breakpoints_.back())) {
+        throw std::out_of_range("Inverse table queried outside the range of f");
+    }
+
+    // Step 1
+    const auto upper = std::upper_bound(breakpoints_.begin() + 1, breakpoints_.end() - 1, y);
+    const int piece = static_cast<int>(upper - breakpoints_.begin()) - 1;
+    const double* entry = data_.data() + piece * (degree_ + 3);
+
+    // Step 2
+    const double t = (y - entry[0]) * entry[1];
+    const auto [x, dx_dt] = clenshaw(degree_, entry + 2, t);
+    if (!polish) {
+        return x;
+    }
+
+    // Step 3: dx/dy = 1 / f'(x), so the Newton step needs only f(x).
+    return x - (func_(x) - y) * dx_dt * entry[1];
+}
+
+/**
+ * @brief Approximate x with f(x) = y for every entry of y.
+ *
+ * @param y Values in the range of f.
+ * @param polish Whether to apply one Newton step to every result.
+ * @return Approximate inverses, one per value.
+ */
+std::vector<double> InverseTable::evaluate(const std::vector<double>& y, bool polish) const {
+    std::vector<double> x;
+    x.reserve(y.size());
+    for (double value : y) {
+        x.push_back(evaluate(value, polish));
+    }
+    return x;
+}
+
+/**
+ * @brief Number of pieces in the partition.
+ *
+ * @return Piece count.
+ */
+int InverseTable::pieces() const {
+    return static_cast<int>(breakpoints_.size()) - 1;
+}
+
+/**
+ * @brief Smallest value of f on [a, b].
+ *
+ * @return Lower end of the table range.
+ */
+double InverseTable::lower() const {
+    return breakpoints_.front();
+}
+
+/**
+ * @brief Largest value of f on [a, b].
+ *
+ * @return Upper end of the table range.
+ */
+double InverseTable::upper() const {
+    return breakpoints_.back();
+}
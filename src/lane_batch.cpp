@@ -0,0 +1,362 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "numeric/lane_batch.hpp"
+
+namespace {
+
+/**
+ * @brief Check the lane count and allocate a result for count problems.
+ *
+ * @param count Number of problems.
+ * @param lanes Number of lanes.
+ * @return Result with NaN roots and MAX_ITERATIONS statuses.
+ */
+LaneBatchResult start_result(int count, int lanes){
+    if (lanes < 1) {
+        throw std::invalid_argument("Lane batch expects at least one lane");
+    }
+    LaneBatchResult result;
+    result.roots.assign(count, std::numeric_limits<double>::quiet_NaN());
+    result.iterations.assign(count, 0);
+    result.status.assign(count, SolveStatus::MAX_ITERATIONS);
+    return result;
+}
+
+/**
+ * @brief Count one batch call.
+ *
+ * @param result Result being accumulated.
+ * @param active Number of live lanes passed to the call.
+ */
+void record_call(LaneBatchResult& result, int active){
+    result.batch_calls += 1;
+    result.lane_evaluations += active;
+}
+
+/**
+ * @brief Set the utilization once every problem has retired.
+ *
+ * @param result Result being accumulated.
+ * @param lanes Number of lanes.
+ * @return The finished result.
+ */
+LaneBatchResult finish_result(LaneBatchResult& result, int lanes){
+    if (result.batch_calls > 0) {
+        result.utilization = static_cast<double>(result.lane_evaluations) / (static_cast<double>(result.batch_calls) * lanes);
+    }
+    return std::move(result);
+}
+
+/**
+ * @brief Select the parameter set of problem k.
+ *
+ * @param params No parameter sets, one shared by every problem, or one per
+ * problem.
+ * @param empty Parameter set used when params is empty.
+ * @param k Problem index.
+ * @return Parameter set of problem k.
+ */
+const std::vector<double>& problem_parameters(
+    const std::vector<std::vector<double>>& params,
+    const std::vector<double>& empty,
+    int k
+){
+    if (params.empty()) {
+        return empty;
+    }
+    return params[params.size() == 1 ? 0 : k];
+}
+
+/**
+ * @brief Check that every parameter set holds the parameters an expression
+ * references, since the lane evaluators read them unchecked.
+ *
+ * @param func Compiled expression.
+ * @param params No parameter sets, one shared by every problem, or one per
+ * problem.
+ */
+void check_parameter_sets(const CompiledExpression& func, const std::vector<std::vector<double>>& params){
+    const std::size_t needed = static_cast<std::size_t>(func.parameter_count());
+    bool enough = !params.empty() || needed == 0;
+    for (const std::vector<double>& set : params) {
+        enough = enough && set.size() >= needed;
+    }
+    if (!enough) {
+        throw std::invalid_argument("Expression expects " + std::to_string(needed) + " parameters");
+    }
+}
+
+}  // namespace
+
+/**
+ * @brief Approximate roots of many problems f_k(x) = 0 using the
+ * Newton-Raphson method on a fixed number of dense lanes. Algorithm 2.3 in
+ * "Numerical Analysis".
+ *
+ * @param func Function and derivative evaluated on a batch of lanes.
+ * @param x0 Initial approximations, one per problem.
+ * @param lanes Number of lanes.
+ * @param MAX_ITERS Maximum number of iterations per problem.
+ * @param TOL Convergence tolerance.
+ * @return Roots, iteration counts and statuses in problem order.
+ */
+LaneBatchResult newton_method_lanes(
+    const LaneFunctionDerivative& func,
+    const std::vector<double>& x0,
+    int lanes,
+    int MAX_ITERS,
+    double TOL
+){
+    const int count = static_cast<int>(x0.size());
+    LaneBatchResult result = start_result(count, lanes);
+
+    // Lane state in structure-of-arrays form; live lanes are always the
+    // first active entries.
+    std::vector<int> problem, iteration;
+    std::vector<double> x, x_next, f_x, fdx_x;
+    for (std::vector<int>* lane : {&problem, &iteration}) {
+        lane->assign(lanes, 0);
+    }
+    for (std::vector<double>* lane : {&x, &x_next, &f_x, &fdx_x}) {
+        lane->assign(lanes, 0.0);
+    }
+    int active = 0;
+    int pending = 0;
+
+    while (true) {
+        // Refill the lanes freed by the last compaction from the queue.
+        while (active < lanes && pending < count) {
+            problem[active] = pending;
+            x[active] = x0[pending];
+            // Step 1
+            iteration[active] = 1;
+            active += 1;
+            pending += 1;
+        }
+        if (active == 0) {
+            break;
+        }
+
+        // Step 3
+        func(problem.data(), x.data(), f_x.data(), fdx_x.data(), active);
+        record_call(result, active);
+        for (int ii = 0; ii < active; ii++) {
+            x_next[ii] = x[ii] - f_x[ii] / fdx_x[ii];
+        }
+
+        // Retire finished problems and compact the rest to the front.
+        int kept = 0;
+        for (int ii = 0; ii < active; ii++) {
+            const int k = problem[ii];
+            // Step 4
+            if (std::abs(x_next[ii] - x[ii]) < TOL) {
+                result.roots[k] = x_next[ii];
+                result.iterations[k] = iteration[ii];
+                result.status[k] = SolveStatus::CONVERGED;
+                continue;
+            }
+            // Step 7
+            if (iteration[ii] >= MAX_ITERS) {
+                result.roots[k] = x_next[ii];
+                result.iterations[k] = MAX_ITERS;
+                continue;
+            }
+            // Steps 5 and 6
+            problem[kept] = k;
+            x[kept] = x_next[ii];
+            iteration[kept] = iteration[ii] + 1;
+            kept += 1;
+        }
+        active = kept;
+    }
+    return finish_result(result, lanes);
+}
+
+/**
+ * @brief Approximate roots of many problems f_k(x) = 0 using the Secant
+ * method on a fixed number of dense lanes. Algorithm 2.4 in "Numerical
+ * Analysis".
+ *
+ * @param func Function evaluated on a batch of lanes.
+ * @param x0 First initial approximations, one per problem.
+ * @param x1 Second initial approximations, one per problem.
+ * @param lanes Number of lanes.
+ * @param MAX_ITERS Maximum number of iterations per problem.
+ * @param TOL Convergence tolerance.
+ * @return Roots, iteration counts and statuses in problem order.
+ */
+LaneBatchResult secant_method_lanes(
+    const LaneFunction& func,
+    const std::vector<double>& x0,
+    const std::vector<double>& x1,
+    int lanes,
+    int MAX_ITERS,
+    double TOL
+){
+    if (x0.size() != x1.size()) {
+        throw std::invalid_argument("Secant lanes expect as many second initial approximations as first ones");
+    }
+    const int count = static_cast<int>(x0.size());
+    LaneBatchResult result = start_result(count, lanes);
+
+    // point holds the x each lane is evaluated at: p0 on a lane's first
+    // call, p1 afterwards.
+    std::vector<int> problem, iteration;
+    std::vector<char> primed;
+    std::vector<double> p0, p1, q0, point, value;
+    for (std::vector<int>* lane : {&problem, &iteration}) {
+        lane->assign(lanes, 0);
+    }
+    primed.assign(lanes, 0);
+    for (std::vector<double>* lane : {&p0, &p1, &q0, &point, &value}) {
+        lane->assign(lanes, 0.0);
+    }
+    int active = 0;
+    int pending = 0;
+
+    while (true) {
+        // Refill the lanes freed by the last compaction from the queue.
+        while (active < lanes && pending < count) {
+            problem[active] = pending;
+            p0[active] = x0[pending];
+            p1[active] = x1[pending];
+            point[active] = x0[pending];
+            primed[active] = 0;
+            // Step 1
+            iteration[active] = 2;
+            active += 1;
+            pending += 1;
+        }
+        if (active == 0) {
+            break;
+        }
+
+        func(problem.data(), point.data(), value.data(), active);
+        record_call(result, active);
+
+        // Retire finished problems and compact the rest to the front.
+        int kept = 0;
+        for (int ii = 0; ii < active; ii++) {
+            const int k = problem[ii];
+            double p0_next = p1[ii];
+            double q0_next = value[ii];
+            double p1_next = p1[ii];
+            int iteration_next = iteration[ii];
+            if (primed[ii]) {
+                // Step 3
+                const double x = p1[ii] - value[ii] * (p1[ii] - p0[ii]) / (value[ii] - q0[ii]);
+
+                // Step 4
+                if (std::abs(x - p1[ii]) < TOL) {
+                    result.roots[k] = x;
+                    result.iterations[k] = iteration[ii];
+                    result.status[k] = SolveStatus::CONVERGED;
+                    continue;
+                }
+                // Step 7
+                if (iteration[ii] >= MAX_ITERS) {
+                    result.roots[k] = x;
+                    result.iterations[k] = MAX_ITERS;
+                    continue;
+                }
+                // Steps 5 and 6
+                p1_next = x;
+                iteration_next += 1;
+            } else {
+                // The lane has evaluated f(p0); evaluate f(p1) next.
+                p0_next = p0[ii];
+            }
+            problem[kept] = k;
+            p0[kept] = p0_next;
+            q0[kept] = q0_next;
+            p1[kept] = p1_next;
+            point[kept] = p1_next;
+            primed[kept] = 1;
+            iteration[kept] = iteration_next;
+            kept += 1;
+        }
+        active = kept;
+    }
+    return finish_result(result, lanes);
+}
+
+/**
+ * @brief Approximate roots of parametrized problems f(p_k, x) = 0 using
+ * newton_method_lanes.
+ *
+ * @param func Compiled function of x with parameters p.
+ * @param x0 Initial approximations, one per problem.
+ * @param params No parameter sets, one shared by every problem, or one per
+ * problem.
+ * @param lanes Number of lanes.
+ * @param MAX_ITERS Maximum number of iterations per problem.
+ * @param TOL Convergence tolerance.
+ * @return Roots, iteration counts and statuses in problem order.
+ */
+LaneBatchResult newton_method_lanes(
+    const CompiledExpression& func,
+    const std::vector<double>& x0,
+    const std::vector<std::vector<double>>& params,
+    int lanes,
+    int MAX_ITERS,
+    double TOL
+){
+    if (params.size() > 1 && params.size() != x0.size()) {
+        throw std::invalid_argument("Batch expects no parameter sets, one, or one per initial approximation");
+    }
+    check_parameter_sets(func, params);
+    const std::vector<double> no_parameters;
+    std::vector<const double*> lane_parameters;
+    lane_parameters.assign(std::max(lanes, 0), nullptr);
+    const LaneFunctionDerivative batch = [&](const int* problems, const double* x, double* f_x, double* fdx_x, int n) {
+        for (int ii = 0; ii < n; ii++) {
+            lane_parameters[ii] = problem_parameters(params, no_parameters, problems[ii]).data();
+        }
+        func.evaluate_derivative_lanes(x, lane_parameters.data(), f_x, fdx_x, n);
+    };
+    return newton_method_lanes(batch, x0, lanes, MAX_ITERS, TOL);
+}
+
+/**
+ * @brief Approximate roots of parametrized problems f(p_k, x) = 0 using
+ * secant_method_lanes.
+ *
+ * @param func Compiled function of x with parameters p.
+ * @param x0 First initial approximations, one per problem.
+ * @param x1 Second initial approximations, one per problem.
+ * @param params No parameter sets, one shared by every problem, or one per
+ * problem.
+ * @param lanes Number of lanes.
+ * @param MAX_ITERS Maximum number of iterations per problem.
+ * @param TOL Convergence tolerance.
+ * @return Roots, iteration counts and statuses in problem order.
+ */
+LaneBatchResult secant_method_lanes(
+    const CompiledExpression& func,
+    const std::vector<double>& x0,
+    const std::vector<double>& x1,
+    const std::vector<std::vector<double>>& params,
+    int lanes,
+    int MAX_ITERS,
+    double TOL
+){
+    if (params.size() > 1 && params.size() != x0.size()) {
+        throw std::invalid_argument("Batch expects no parameter sets, one, or one per initial approximation");
+    }
+    check_parameter_sets(func, params);
+    const std::vector<double> no_parameters;
+    std::vector<const double*> lane_parameters;
+    lane_parameters.assign(std::max(lanes, 0), nullptr);
+    const LaneFunction batch = [&](const int* problems, const double* x, double* f_x, int n) {
+        for (int ii = 0; ii < n; ii++) {
+            lane_parameters[ii] = problem_parameters(params, no_parameters, problems[ii]).data();
+        }
+        func.evaluate_lanes(x, lane_parameters.data(), f_x, n);
+    };
+    return secant_method_lanes(batch, x0, x1, lanes, MAX_ITERS, TOL);
+}
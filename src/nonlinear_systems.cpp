@@ -0,0 +1,359 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "numeric/nonlinear_systems.hpp"
+
+namespace {
+
+/**
+ * @brief Infinity norm of a vector.
+ *
+ * @param x Vector of length n.
+ * @return max |x_i|.
+ */
+double infinity_norm(const std::vector<double>& x){
+    double norm = 0.0;
+    for (double value : x) {
+        norm = std::max(norm, std::abs(value));
+    }
+    return norm;
+}
+
+/**
+ * @brief Evaluate F at x and check that the result has the expected length.
+ *
+ * @param func Continuous function F: R^n -> R^n.
+ * @param x Point at which F is evaluated.
+ * @param out Destination for F(x).
+ */
+void evaluate_system(
+    const std::function<std::vector<double>(const std::vector<double>&)>& func,
+    const std::vector<double>& x,
+    std::vector<double>& out
+){
+    out = func(x);
+    if (out.size() != x.size()) {
+        throw std::invalid_argument("F(x) must return as many components as x");
+    }
+}
+
+/**
+ * @brief Fill a row-major Jacobian approximation using centered differences.
+ *
+ * @param func Continuous function F: R^n -> R^n.
+ * @param x Point at which the Jacobian is evaluated.
+ * @param epsilon Small perturbation for numerical derivative.
+ * @param workspace Scratch storage; the Jacobian is written to workspace.J.
+ */
+void fill_jacobian(
+    const std::function<std::vector<double>(const std::vector<double>&)>& func,
+    const std::vector<double>& x,
+    double epsilon,
+    BroydenWorkspace& workspace
+){
+    const int n = workspace.n;
+    workspace.x_plus = x;
+    workspace.x_minus = x;
+
+    for (int jj = 0; jj < n; jj++) {
+        workspace.x_plus[jj] = x[jj] + epsilon;
+        workspace.x_minus[jj] = x[jj] - epsilon;
+        evaluate_system(func, workspace.x_plus, workspace.y);
+        evaluate_system(func, workspace.x_minus, workspace.z);
+        for (int ii = 0; ii < n; ii++) {
+            workspace.J[ii * n + jj] = (workspace.y[ii] - workspace.z[ii]) / (2 * epsilon);
+        }
+        workspace.x_plus[jj] = x[jj];
+        workspace.x_minus[jj] = x[jj];
+    }
+}
+
+/**
+ * @brief Invert workspace.J into workspace.A using Gauss-Jordan elimination
+ * with partial pivoting. workspace.J is overwritten.
+ *
+ * @param workspace Storage holding the matrix to invert.
+ */
+void invert_jacobian(BroydenWorkspace& workspace){
+    const int n = workspace.n;
+    std::vector<double>& J = workspace.J;
+    std::vector<double>& A = workspace.A;
+
+    for (int ii = 0; ii < n * n; ii++) {
+        A[ii] = 0.0;
+    }
+    for (int ii = 0; ii < n; ii++) {
+        A[ii * n + ii] = 1.0;
+    }
+
+    for (int col = 0; col < n; col++) {
+        int pivot = col;
+        for (int row = col + 1; row < n; row++) {
+            if (std::abs(J[row * n + col]) > std::abs(J[pivot * n + col])) {
+                pivot = row;
+            }
+        }
+        if (J[pivot * n + col] == 0.0) {
+            throw std::runtime_error("Broyden's method encountered a singular Jacobian");
+        }
+        if (pivot != col) {
+            for (int jj = 0; jj < n; jj++) {
+                std::swap(J[pivot * n + jj], J[col * n + jj]);
+                std::swap(A[pivot * n + jj], A[col * n + jj]);
+            }
+        }
+
+        const double scale = 1.0 / J[col * n + col];
+        for (int jj = 0; jj < n; jj++) {
+            J[col * n + jj] *= scale;
+            A[col * n + jj] *= scale;
+        }
+
+        for (int row = 0; row < n; row++) {
+            const double factor = J[row * n + col];
+            if (row == col || factor == 0.0) {
+                continue;
+            }
+            for (int jj = 0; jj < n; jj++) {
+                J[row * n + jj] -= factor * J[col * n + jj];
+                A[row * n + jj] -= factor * A[col * n + jj];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Compute out = -A b for the row-major n x n matrix A.
+ *
+ * @param A Matrix of size n x n.
+ * @param b Vector of length n.
+ * @param n Dimension.
+ * @param out Destination vector of length n.
+ */
+void negative_product(
+    const std::vector<double>& A,
+    const std::vector<double>& b,
+    int n,
+    std::vector<double>& out
+){
+    for (int ii = 0; ii < n; ii++) {
+        double sum = 0.0;
+        for (int jj = 0; jj < n; jj++) {
+            sum += A[ii * n + jj] * b[jj];
+        }
+        out[ii] = -sum;
+    }
+}
+
+}  // namespace
+
+/**
+ * @brief Construct a workspace for systems of n equations.
+ *
+ * @param n Number of equations and unknowns.
+ */
+BroydenWorkspace::BroydenWorkspace(int n){
+    resize(n);
+}
+
+/**
+ * @brief Resize the workspace for systems of n equations. Storage is only
+ * reallocated when n changes.
+ *
+ * @param n Number of equations and unknowns.
+ */
+void BroydenWorkspace::resize(int n){
+    if (n < 0) {
+        throw std::invalid_argument("Broyden workspace expects a non-negative dimension");
+    }
+    if (n == this->n && static_cast<int>(A.size()) == n * n) {
+        return;
+    }
+    this->n = n;
+    A.assign(n * n, 0.0);
+    J.assign(n * n, 0.0);
+    for (std::vector<double>* vec : {&v, &w, &y, &z, &s, &u, &x_plus, &x_minus}) {
+        vec->assign(n, 0.0);
+    }
+}
+
+/**
+ * @brief Approximate the Jacobian matrix of F at x using centered differences.
+ *
+ * @param func Continuous function F: R^n -> R^n.
+ * @param x Point at which the Jacobian is evaluated.
+ * @param epsilon Small perturbation for numerical derivative.
+ * @return Row-major n x n matrix with entries dF_i / dx_j.
+ */
+std::vector<double> finite_difference_jacobian(
+    const std::function<std::vector<double>(const std::vector<double>&)>& func,
+    const std::vector<double>& x,
+    double epsilon
+){
+    BroydenWorkspace workspace{static_cast<int>(x.size())};
+    fill_jacobian(func, x, epsilon, workspace);
+    return workspace.J;
+}
+
+/**
+ * @brief Approximate a solution of F(x) = 0 using Broyden's method. Algorithm
+ * 10.2 in "Numerical Analysis".
+ *
+ * @param func Continuous function F: R^n -> R^n.
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance for the infinity norm of the step.
+ * @return Approximate x to solution F(x) = 0.
+ */
+std::vector<double> broyden_method(
+    const std::function<std::vector<double>(const std::vector<double>&)>& func,
+    std::vector<double> x0,
+    int MAX_ITERS,
+    double TOL
+){
+    BroydenWorkspace workspace;
+    return broyden_method(func, std::move(x0), MAX_ITERS, TOL, workspace);
+}
+
+/**
+ * @brief Approximate a solution of F(x) = 0 using Broyden's method with a
+ * caller-provided workspace. Algorithm 10.2 in "Numerical Analysis".
+ *
+ * @param func Continuous function F: R^n -> R^n.
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance for the infinity norm of the step.
+ * @param workspace Storage reused across calls; resized to n if required.
+ * @return Approximate x to solution F(x) = 0.
+ */
+std::vector<double> broyden_method(
+    const std::function<std::vector<double>(const std::vector<double>&)>& func,
+    std::vector<double> x0,
+    int MAX_ITERS,
+    double TOL,
+    BroydenWorkspace& workspace
+){
+    const int n = static_cast<int>(x0.size());
+    if (n == 0) {
+        throw std::invalid_argument("Broyden's method expects a non-empty initial approximation");
+    }
+    workspace.resize(n);
+
+    std::vector<double>& x = x0;
+    std::vector<double>& A = workspace.A;
+    std::vector<double>& v = workspace.v;
+    std::vector<double>& w = workspace.w;
+    std::vector<double>& y = workspace.y;
+    std::vector<double>& z = workspace.z;
+    std::vector<double>& s = workspace.s;
+    std::vector<double>& u = workspace.u;
+
+    // Step 1
+    fill_jacobian(func, x, 1e-3, workspace);
+    evaluate_system(func, x, v);
+
+    // Step 2
+    invert_jacobian(workspace);
+
+    // Step 3
+    negative_product(A, v, n, s);
+    for (int ii = 0; ii < n; ii++) {
+        x[ii] += s[ii];
+    }
+    if (infinity_norm(s) < TOL) {
+        return x;
+    }
+    int iteration = 2;
+
+    // Step 4
+    while (iteration <= MAX_ITERS) {
+        // Step 5
+        w.swap(v);
+        evaluate_system(func, x, v);
+        for (int ii = 0; ii < n; ii++) {
+            y[ii] = v[ii] - w[ii];
+        }
+
+        // Step 6
+        negative_product(A, y, n, z);
+
+        // Step 7
+        double p = 0.0;
+        for (int ii = 0; ii < n; ii++) {
+            p -= s[ii] * z[ii];
+        }
+        if (p == 0.0) {
+            throw std::runtime_error("Broyden's method encountered zero denominator");
+        }
+
+        // Step 8
+        for (int jj = 0; jj < n; jj++) {
+            double sum = 0.0;
+            for (int ii = 0; ii < n; ii++) {
+                sum += s[ii] * A[ii * n + jj];
+            }
+            u[jj] = sum;
+        }
+
+        // Step 9
+        for (int ii = 0; ii < n; ii++) {
+            const double scale = (s[ii] + z[ii]) / p;
+            for (int jj = 0; jj < n; jj++) {
+                A[ii * n + jj] += scale * u[jj];
+            }
+        }
+
+        // Step 10
+        negative_product(A, v, n, s);
+
+        // Step 11
+        for (int ii = 0; ii < n; ii++) {
+            x[ii] += s[ii];
+        }
+
+        // Step 12
+        if (infinity_norm(s) < TOL) {
+            return x;
+        }
+
+        // Step 13
+        iteration += 1;
+    }
+
+    // Step 14
+    std::cerr << "Broyden's Method not converged after " << MAX_ITERS << " iterations. "
+              << "Final tolerance is " << infinity_norm(s) << std::endl;
+    return x;
+}
+
+/**
+ * @brief Solve many independent systems F_k(x) = 0 with Broyden's method,
+ * sharing a single workspace between them.
+ *
+ * @param func Continuous function F(k, x) evaluating system k at x.
+ * @param x0 Initial approximations, one per system.
+ * @param MAX_ITERS Maximum number of iterations per system.
+ * @param TOL Convergence tolerance for the infinity norm of the step.
+ * @return Approximate solutions, one per system.
+ */
+std::vector<std::vector<double>> broyden_method_batch(
+    const std::function<std::vector<double>(int, const std::vector<double>&)>& func,
+    const std::vector<std::vector<double>>& x0,
+    int MAX_ITERS,
+    double TOL
+){
+    std::vector<std::vector<double>> solutions;
+    solutions.reserve(x0.size());
+
+    BroydenWorkspace workspace;
+    for (int kk = 0; kk < static_cast<int>(x0.size()); kk++) {
+        const auto system = [&func, kk](const std::vector<double>& x) {
+            return func(kk, x);
+        };
+        solutions.push_back(broyden_method(system, x0[kk], MAX_ITERS, TOL, workspace));
+    }
+    return solutions;
+}
@@ -1,8 +1,34 @@
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
+#include "numeric/chebyshev.hpp"
+#include "numeric/differentiation.hpp"
 #include "numeric/root_approximation.hpp"
+#include "numeric/thread_pool.hpp"
+
+namespace {
+
+/**
+ * @brief Options matching the legacy MAX_ITERS and TOL signatures, with no
+ * deadline, evaluation budget or cancellation.
+ *
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Solve options.
+ */
+SolveOptions legacy_options(int MAX_ITERS, double TOL){
+    SolveOptions options;
+    options.max_iters = MAX_ITERS;
+    options.tol = TOL;
+    return options;
+}
+
+}  // namespace
 
 /**
  * @brief Approximate a root of f(x) = 0 using the bisection method. Algorithm
@@ -22,38 +48,67 @@ double bisection(
     int MAX_ITERS,
     double TOL
 ){
-    double f_a, f_x, x;
+    const SolveResult result = bisection(func, a, b, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Bisection Method not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
+    }
+    return result.root;
+}
 
-    // Step 1
-    int iteration = 1;
-    f_a = func(a);
+/**
+ * @brief Approximate a root of f(x) = 0 using the bisection method under
+ * deadline, evaluation budget and cancellation limits. Algorithm 2.1 in
+ * "Numerical Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param a Left endpoint of the interval.
+ * @param b Right endpoint of the interval.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final half-interval width.
+ */
+SolveResult bisection(
+    const std::function<double(double)>& func,
+    double a,
+    double b,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, a + 0.5 * (b - a)};
+    int iteration = 0;
+    try {
+        double f_a, f_x, x = a + 0.5 * (b - a);
 
-    // Step 2
-    while (iteration <= MAX_ITERS) {
-        // Step 3
-        x = a + 0.5 * (b - a);
-        f_x = func(x);
+        // Step 1
+        iteration = 1;
+        f_a = monitor.evaluate(func, a);
 
-        // Step 4
-        if (f_x == 0 || 0.5 * (b - a) < TOL) {
-            return x;
-        }
-        // Step 5
-        iteration += 1;
-
-        // Step 6
-        if (f_a * f_x > 0) {
-            a = x;
-            f_a = f_x;
-        } else {
-            b = x;
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            x = a + 0.5 * (b - a);
+            f_x = monitor.evaluate(func, x);
+
+            // Step 4
+            if (f_x == 0 || 0.5 * (b - a) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, 0.5 * (b - a));
+            }
+            // Step 5
+            iteration += 1;
+
+            // Step 6
+            if (f_a * f_x > 0) {
+                a = x;
+                f_a = f_x;
+            } else {
+                b = x;
+            }
         }
-    }
 
-    // Step 7
-    std::cerr << "Bisection Method not converged after " << MAX_ITERS << " iterations. "
-              << "Final tolerance is " << 0.5 * (b - a) << std::endl;
-    return x;
+        // Step 7
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, 0.5 * (b - a));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
+    }
 }
 
 
@@ -73,34 +128,59 @@ double fixed_point(
     int MAX_ITERS,
     double TOL
 ){
+    const SolveResult result = fixed_point(func, x0, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Fixed Point Iteration not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
+    }
+    return result.root;
+}
 
-    double x;
-
-    // Step 1
-    int iteration = 1;
+/**
+ * @brief Approximate a fixed point x = g(x) using fixed point iteration under
+ * deadline, evaluation budget and cancellation limits. Algorithm 2.2 in
+ * "Numerical Analysis". The monitored residual is g(x) - x.
+ *
+ * @param func Continuous function g(x).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult fixed_point(
+    const std::function<double(double)>& func,
+    double x0,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, x0};
+    int iteration = 0;
+    try {
+        double x = x0;
 
-    // Step 2
-    while (iteration <= MAX_ITERS) {
-        // Step 3
-        x = func(x0);
+        // Step 1
+        iteration = 1;
 
-        // Step 4
-        if (std::abs(x - x0) < TOL) {
-            return x;
-        }
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            x = monitor.evaluate_fixed_point(func, x0);
 
-        // Step 5
-        iteration += 1;
+            // Step 4
+            if (std::abs(x - x0) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, std::abs(x - x0));
+            }
 
-        // Step 6
-        x0 = x;
-    }
+            // Step 5
+            iteration += 1;
 
-    // Step 7
-    std::cerr << "Fixed Point Iteration not converged after " << MAX_ITERS << " iterations. "
-              << "Final tolerance is " << std::abs(x - x0) << std::endl;
+            // Step 6
+            x0 = x;
+        }
 
-    return x;
+        // Step 7
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(x - x0));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
+    }
 }
 
 /**
@@ -137,33 +217,297 @@ double newton_method(
     int MAX_ITERS,
     double TOL
 ){
-    double fdx_x, x;
+    const SolveResult result = newton_method(func, x0, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Newton's Method not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
+    }
+    return result.root;
+}
 
-    // Step 1
-    int iteration = 1;
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method under
+ * deadline, evaluation budget and cancellation limits. Algorithm 2.3 in
+ * "Numerical Analysis". The two evaluations of each finite-difference
+ * derivative count towards the budget.
+ *
+ * @param func Continuous function f(x).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult newton_method(
+    const std::function<double(double)>& func,
+    double x0,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, x0};
+    const std::function<double(double)> monitored = [&monitor, &func](double x) {
+        return monitor.evaluate(func, x);
+    };
+    int iteration = 0;
+    try {
+        double fdx_x, x = x0;
 
-    // Step 2
-    while (iteration <= MAX_ITERS) {
-        // Step 3
-        fdx_x = first_derivative(func, x0, 1e-3);
-        x = x0 - func(x0) / fdx_x;
+        // Step 1
+        iteration = 1;
 
-        // Step 4
-        if (std::abs(x - x0) < TOL) {
-            return x;
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            fdx_x = first_derivative(monitored, x0, optimal_step(x0, 2));
+            x = x0 - monitored(x0) / fdx_x;
+
+            // Step 4
+            if (std::abs(x - x0) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, std::abs(x - x0));
+            }
+
+            // Step 5
+            iteration += 1;
+
+            // Step 6
+            x0 = x;
+        }
+
+        // Step 7
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(x - x0));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
+    }
+}
+
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method with a
+ * known derivative. Algorithm 2.3 in "Numerical Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param dfunc Derivative f'(x).
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0 with initial approximation.
+ */
+double newton_method(
+    const std::function<double(double)>& func,
+    const std::function<double(double)>& dfunc,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+){
+    const SolveResult result = newton_method(func, dfunc, x0, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Newton's Method not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
+    }
+    return result.root;
+}
+
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method with a
+ * known derivative under deadline, evaluation budget and cancellation limits.
+ * Algorithm 2.3 in "Numerical Analysis". Only evaluations of f count towards
+ * the budget.
+ *
+ * @param func Continuous function f(x).
+ * @param dfunc Derivative f'(x).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult newton_method(
+    const std::function<double(double)>& func,
+    const std::function<double(double)>& dfunc,
+    double x0,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, x0};
+    int iteration = 0;
+    try {
+        double fdx_x, x = x0;
+
+        // Step 1
+        iteration = 1;
+
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            fdx_x = dfunc(x0);
+            x = x0 - monitor.evaluate(func, x0) / fdx_x;
+
+            // Step 4
+            if (std::abs(x - x0) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, std::abs(x - x0));
+            }
+
+            // Step 5
+            iteration += 1;
+
+            // Step 6
+            x0 = x;
         }
 
-        // Step 5
-        iteration += 1;
+        // Step 7
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(x - x0));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
+    }
+}
 
-        // Step 6
-        x0 = x;
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method with
+ * f and f' returned together by one call, as from a derivative tape.
+ * Algorithm 2.3 in "Numerical Analysis".
+ *
+ * @param func_derivative Function returning the tuple (f(x), f'(x)).
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0 with initial approximation.
+ */
+double newton_method(
+    const std::function<std::tuple<double, double>(double)>& func_derivative,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+){
+    const SolveResult result = newton_method(func_derivative, x0, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Newton's Method not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
     }
+    return result.root;
+}
 
-    // Step 7
-    std::cerr << "Newton's Method not converged after " << MAX_ITERS << " iterations. "
-              << "Final tolerance is " << std::abs(x - x0) << std::endl;
-    return x;
+/**
+ * @brief Approximate a root of f(x) = 0 using the Newton-Raphson method with
+ * f and f' returned together by one call, under deadline, evaluation budget
+ * and cancellation limits. Algorithm 2.3 in "Numerical Analysis". Each call
+ * counts as one evaluation.
+ *
+ * @param func_derivative Function returning the tuple (f(x), f'(x)).
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult newton_method(
+    const std::function<std::tuple<double, double>(double)>& func_derivative,
+    double x0,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, x0};
+    int iteration = 0;
+    try {
+        double x = x0;
+
+        // Step 1
+        iteration = 1;
+
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            const auto [f_x, fdx_x] = monitor.evaluate_derivative(func_derivative, x0);
+            x = x0 - f_x / fdx_x;
+
+            // Step 4
+            if (std::abs(x - x0) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, std::abs(x - x0));
+            }
+
+            // Step 5
+            iteration += 1;
+
+            // Step 6
+            x0 = x;
+        }
+
+        // Step 7
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(x - x0));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
+    }
+}
+
+/**
+ * @brief Approximate a root of f(x) = 0 using Halley's method. f, f' and f''
+ * are obtained from a single evaluation of func on a second-order Taylor
+ * variable, giving cubic convergence near simple roots.
+ *
+ * @param func Twice differentiable function f(x) written for Taylor<2> inputs.
+ * @param x0 Initial approximation.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(x) = 0 with initial approximation.
+ */
+double halley_method(
+    const std::function<Taylor<2>(const Taylor<2>&)>& func,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+){
+    const SolveResult result = halley_method(func, x0, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Halley's Method not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
+    }
+    return result.root;
+}
+
+/**
+ * @brief Approximate a root of f(x) = 0 using Halley's method under deadline,
+ * evaluation budget and cancellation limits.
+ *
+ * @param func Twice differentiable function f(x) written for Taylor<2> inputs.
+ * @param x0 Initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult halley_method(
+    const std::function<Taylor<2>(const Taylor<2>&)>& func,
+    double x0,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, x0};
+    int iteration = 0;
+    try {
+        double f_x, fdx_x, fdx2_x, denominator, x = x0;
+
+        // Step 1
+        iteration = 1;
+
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            const Taylor<2> f = monitor.evaluate(func, x0);
+            f_x = f.value();
+            fdx_x = f.derivative(1);
+            fdx2_x = f.derivative(2);
+            if (f_x == 0.0) {
+                return monitor.finish(x0, SolveStatus::CONVERGED, iteration, 0.0);
+            }
+            denominator = 2 * fdx_x * fdx_x - f_x * fdx2_x;
+            if (denominator == 0.0) {
+                throw std::runtime_error("Halley's method encountered zero denominator");
+            }
+            x = x0 - 2 * f_x * fdx_x / denominator;
+
+            // Step 4
+            if (std::abs(x - x0) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, std::abs(x - x0));
+            }
+
+            // Step 5
+            iteration += 1;
+
+            // Step 6
+            x0 = x;
+        }
+
+        // Step 7
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(x - x0));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
+    }
 }
 
 /**
@@ -184,38 +528,66 @@ double secant_method(
     int MAX_ITERS,
     double TOL
 ){
-    double f_x0, f_x1, x;
+    const SolveResult result = secant_method(func, x0, x1, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Secant Method not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
+    }
+    return result.root;
+}
 
-    // Step 1
-    int iteration = 2;
-    f_x0 = func(x0);
-    f_x1 = func(x1);
+/**
+ * @brief Approximate a root of f(x) = 0 using the secant method under deadline,
+ * evaluation budget and cancellation limits. Algorithm 2.4 in "Numerical
+ * Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param x0 First initial approximation.
+ * @param x1 Second initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult secant_method(
+    const std::function<double(double)>& func,
+    double x0,
+    double x1,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, x1};
+    int iteration = 0;
+    try {
+        double f_x0, f_x1, x = x1;
 
-    // Step 2
-    while (iteration <= MAX_ITERS) {
-        // Step 3
-        x = x1 - f_x1 * (x1 - x0) / (f_x1 - f_x0);
+        // Step 1
+        iteration = 2;
+        f_x0 = monitor.evaluate(func, x0);
+        f_x1 = monitor.evaluate(func, x1);
 
-        // Step 4
-        if (std::abs(x - x1) < TOL) {
-            return x;
-        }
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            x = x1 - f_x1 * (x1 - x0) / (f_x1 - f_x0);
 
-        // Step 5
-        iteration += 1;
+            // Step 4
+            if (std::abs(x - x1) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, std::abs(x - x1));
+            }
 
-        // Step 6
-        x0 = x1;
-        x1 = x;
-        f_x0 = f_x1;
-        f_x1 = func(x);
-    }
+            // Step 5
+            iteration += 1;
 
-    // Step 7
-    std::cerr << "Secant Method not converged after " << MAX_ITERS << " iterations. "
-              << "Final tolerance is " << std::abs(x - x1) << std::endl;
-    return x;
+            // Step 6
+            x0 = x1;
+            x1 = x;
+            f_x0 = f_x1;
+            f_x1 = monitor.evaluate(func, x);
+        }
 
+        // Step 7
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(x - x1));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
+    }
 }
 
 /**
@@ -236,42 +608,71 @@ double false_position(
     int MAX_ITERS,
     double TOL
 ){
-    double f_x0, f_x1, x, f_x;
+    const SolveResult result = false_position(func, x0, x1, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "False Position Method not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
+    }
+    return result.root;
+}
 
-    // Step 1
-    int iteration = 2;
-    f_x0 = func(x0);
-    f_x1 = func(x1);
+/**
+ * @brief Approximate a root of f(x) = 0 using the false position method under
+ * deadline, evaluation budget and cancellation limits. Algorithm 2.5 in
+ * "Numerical Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param x0 First initial approximation.
+ * @param x1 Second initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is |f| at the retained endpoint.
+ */
+SolveResult false_position(
+    const std::function<double(double)>& func,
+    double x0,
+    double x1,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, x1};
+    int iteration = 0;
+    try {
+        double f_x0, f_x1, x = x1, f_x = std::numeric_limits<double>::quiet_NaN();
 
-    // Step 2
-    while (iteration <= MAX_ITERS) {
-        // Step 3
-        x = x0 - f_x0 * (x1 - x0) / (f_x1 - f_x0);
+        // Step 1
+        iteration = 2;
+        f_x0 = monitor.evaluate(func, x0);
+        f_x1 = monitor.evaluate(func, x1);
 
-        // Step 4
-        if (std::abs(x - x1) < TOL) {
-            return x;
-        }
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            x = x0 - f_x0 * (x1 - x0) / (f_x1 - f_x0);
 
-        // Step 5
-        iteration += 1;
-        f_x = func(x0);
+            // Step 4
+            if (std::abs(x - x1) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, std::abs(x - x1));
+            }
 
-        // Step 6
-        if (f_x1 * f_x < 0) {
-            x0 = x1;
-            f_x0 = f_x1;
+            // Step 5
+            iteration += 1;
+            f_x = monitor.evaluate(func, x0);
+
+            // Step 6
+            if (f_x1 * f_x < 0) {
+                x0 = x1;
+                f_x0 = f_x1;
+            }
+
+            // Step 7
+            x1 = x;
+            f_x1 = monitor.evaluate(func, x);
         }
 
-        // Step 7
-        x1 = x;
-        f_x1 = func(x);
+        // Step 8
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(f_x));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
     }
-
-    // Step 8
-    std::cerr << "False Position Method not converged after " << MAX_ITERS << " iterations. "
-              << "Final tolerance is " << std::abs(f_x) << std::endl;
-    return x;
 }
 
 /**
@@ -290,33 +691,60 @@ double steffensen_method(
     int MAX_ITERS,
     double TOL
 ){
-    double x1, x2, x;
+    const SolveResult result = steffensen_method(func, x0, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Steffensen's Method not converged after " << MAX_ITERS << " iterations. "
+                  << "Final tolerance is " << result.error << std::endl;
+    }
+    return result.root;
+}
 
-    // Step 1
-    int iteration = 1;
+/**
+ * @brief Find a solution to g(x) = x using Steffensen's method under deadline,
+ * evaluation budget and cancellation limits. Algorithm 2.6 in "Numerical
+ * Analysis". The monitored residual is g(x) - x.
+ *
+ * @param func Continuous function g(x).
+ * @param x0 First initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |x_n - x_(n-1)|.
+ */
+SolveResult steffensen_method(
+    const std::function<double(double)>& func,
+    double x0,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, x0};
+    int iteration = 0;
+    try {
+        double x1, x2, x = x0;
 
-    // Step 2
-    while (iteration <= MAX_ITERS) {
-        // Step 3
-        x1 = func(x0);
-        x2 = func(x1);
-        x = x0 - (x1 - x0) * (x1 - x0) / (x2 - 2 * x1 + x0);
+        // Step 1
+        iteration = 1;
 
-        // Step 4
-        if (std::abs(x - x0) < TOL) {
-            return x;
-        }
+        // Step 2
+        while (iteration <= options.max_iters) {
+            // Step 3
+            x1 = monitor.evaluate_fixed_point(func, x0);
+            x2 = monitor.evaluate_fixed_point(func, x1);
+            x = x0 - (x1 - x0) * (x1 - x0) / (x2 - 2 * x1 + x0);
 
-        // Step 5
-        iteration += 1;
+            // Step 4
+            if (std::abs(x - x0) < options.tol) {
+                return monitor.finish(x, SolveStatus::CONVERGED, iteration, std::abs(x - x0));
+            }
 
-        // Step 6
-        x0 = x;
+            // Step 5
+            iteration += 1;
+
+            // Step 6
+            x0 = x;
+        }
+        // Step 7
+        return monitor.finish(x, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(x - x0));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
     }
-    // Step 7
-    std::cerr << "Steffensen's Method not converged after " << MAX_ITERS << " iterations. "
-              << "Final tolerance is " << std::abs(x - x0) << std::endl;
-    return x;
 }
 
 /**
@@ -354,6 +782,73 @@ std::tuple<double, double> horners(int n, const double coefs[], double x0){
     return {y, z};
 }
 
+/**
+ * @brief Evaluate the polynomial P(x) and its derivative at count points using
+ * Horner's method. Algorithm 2.7 in "Numerical Analysis", applied to a block
+ * of points per coefficient.
+ *
+ * @param n The degree of the polynomial.
+ * @param coefs List of length n+1 of polynomial coefficients.
+ * @param x Points that are being evaluated.
+ * @param values Receives P(x[i]).
+ * @param derivatives Receives P'(x[i]).
+ * @param count Number of points.
+ */
+void horners_batch(
+    int n,
+    const double coefs[],
+    const double x[],
+    double values[],
+    double derivatives[],
+    long long count
+){
+    if (n < 0) {
+        throw std::invalid_argument("Horner's expects non-negative polynomial degree");
+    }
+    if (count < 0) {
+        throw std::invalid_argument("Horner's expects a non-negative number of points");
+    }
+
+    constexpr long long BLOCK = 256;
+    double x_block[BLOCK];
+    double y[BLOCK];
+    double z[BLOCK];
+    for (long long start = 0; start < count; start += BLOCK) {
+        const int size = static_cast<int>(std::min(BLOCK, count - start));
+        for (int ii = 0; ii < size; ii++) {
+            x_block[ii] = x[start + ii];
+        }
+
+        // Step 1
+        for (int ii = 0; ii < size; ii++) {
+            y[ii] = coefs[0];
+            z[ii] = n == 0 ? 0.0 : coefs[0];
+        }
+
+        // Step 2
+        for (int jj = 1; jj < n; jj++) {
+            const double coef = coefs[jj];
+            for (int ii = 0; ii < size; ii++) {
+                y[ii] = x_block[ii] * y[ii] + coef;
+                z[ii] = x_block[ii] * z[ii] + y[ii];
+            }
+        }
+
+        // Step 3
+        if (n > 0) {
+            for (int ii = 0; ii < size; ii++) {
+                y[ii] = x_block[ii] * y[ii] + coefs[n];
+            }
+        }
+
+        // Step 4
+        for (int ii = 0; ii < size; ii++) {
+            values[start + ii] = y[ii];
+            derivatives[start + ii] = z[ii];
+        }
+    }
+}
+
 /**
  * @brief Find a solution to f(x) = 0 given 3 approximations using Muller's
  * method. Algorithm 2.8 in "Numerical Analysis".
@@ -374,67 +869,278 @@ double mullers(
     int MAX_ITERS,
     double TOL
 ){
-    double p, b, D, E, h;
-
-    // Step 1
-    double h1 = p1 - p0;
-    double h2 = p2 - p1;
-    if (h1 == 0.0 || h2 == 0.0 || (h2 + h1) == 0.0) {
-        throw std::invalid_argument("Muller's method requires distinct initial approximations");
+    const SolveResult result = mullers(func, p0, p1, p2, legacy_options(MAX_ITERS, TOL));
+    if (result.status == SolveStatus::MAX_ITERATIONS) {
+        std::cerr << "Muller's Method failed after " << MAX_ITERS << " iterations." << std::endl;
     }
+    return result.root;
+}
 
-    double d1 = (func(p1) - func(p0)) / h1;
-    double d2 = (func(p2) - func(p1)) / h2;
-    double d = (d2 - d1) / (h2 + h1);
-    int iteration = 3;
+/**
+ * @brief Find a solution to f(x) = 0 given 3 approximations using Muller's
+ * method under deadline, evaluation budget and cancellation limits. Algorithm
+ * 2.8 in "Numerical Analysis".
+ *
+ * @param func Continuous function f(x).
+ * @param p0 First initial approximation.
+ * @param p1 Second initial approximation.
+ * @param p2 Third initial approximation.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result; error is the final step |h|.
+ */
+SolveResult mullers(
+    const std::function<double(double)>& func,
+    double p0,
+    double p1,
+    double p2,
+    const SolveOptions& options
+){
+    EvaluationMonitor monitor{options, p2};
+    int iteration = 0;
+    try {
+        double p = p2, b, D, E, h = std::numeric_limits<double>::quiet_NaN();
 
-    // Step 2
-    while (iteration <= MAX_ITERS){
-        // Step 3
-        b = d2 + h2 * d;
-        const double f_p2 = func(p2);
-        const double discriminant = std::pow(b, 2) - 4 * f_p2 * d;
-        if (discriminant < 0.0) {
-            throw std::runtime_error("Muller's method encountered a complex discriminant");
+        // Step 1
+        double h1 = p1 - p0;
+        double h2 = p2 - p1;
+        if (h1 == 0.0 || h2 == 0.0 || (h2 + h1) == 0.0) {
+            throw std::invalid_argument("Muller's method requires distinct initial approximations");
         }
-        D = std::sqrt(discriminant);
 
-        // Step 4
-        if (std::abs(b - D) < std::abs(b + D)){
-            E = b + D;
-        } else {
-            E = b - D;
+        double d1 = (monitor.evaluate(func, p1) - monitor.evaluate(func, p0)) / h1;
+        double d2 = (monitor.evaluate(func, p2) - monitor.evaluate(func, p1)) / h2;
+        double d = (d2 - d1) / (h2 + h1);
+        iteration = 3;
+
+        // Step 2
+        while (iteration <= options.max_iters){
+            // Step 3
+            b = d2 + h2 * d;
+            const double f_p2 = monitor.evaluate(func, p2);
+            const double discriminant = std::pow(b, 2) - 4 * f_p2 * d;
+            if (discriminant < 0.0) {
+                throw std::runtime_error("Muller's method encountered a complex discriminant");
+            }
+            D = std::sqrt(discriminant);
+
+            // Step 4
+            if (std::abs(b - D) < std::abs(b + D)){
+                E = b + D;
+            } else {
+                E = b - D;
+            }
+
+            // Step 5
+            if (E == 0.0) {
+                throw std::runtime_error("Muller's method encountered zero denominator");
+            }
+            h = -2 * f_p2 / E;
+            p = p2 + h;
+
+            // Step 6
+
+            if (std::abs(h) < options.tol){
+                return monitor.finish(p, SolveStatus::CONVERGED, iteration, std::abs(h));
+            }
+
+            // Step 7
+            p0 = p1;
+            p1 = p2;
+            p2 = p;
+            h1 = p1 - p0;
+            h2 = p2 - p1;
+            if (h1 == 0.0 || h2 == 0.0 || (h2 + h1) == 0.0) {
+                throw std::runtime_error("Muller's method encountered degenerate interpolation points");
+            }
+            d1 = (monitor.evaluate(func, p1) - monitor.evaluate(func, p0))/h1;
+            d2 = (monitor.evaluate(func, p2) - monitor.evaluate(func, p1))/h2;
+            d = (d2 - d1)/(h2 + h1);
+            iteration += 1;
         }
 
-        // Step 5
-        if (E == 0.0) {
-            throw std::runtime_error("Muller's method encountered zero denominator");
+        // Step 8
+        return monitor.finish(p, SolveStatus::MAX_ITERATIONS, options.max_iters, std::abs(h));
+    } catch (const SolveInterrupted& interrupt) {
+        return monitor.interrupted(interrupt, iteration);
+    }
+}
+
+/**
+ * @brief Enclose every root of f(x) = 0 on [a, b] using the interval Newton
+ * method with bisection, processing the subdivision tree in parallel.
+ *
+ * @param func Interval extension F of f; must be thread-safe.
+ * @param dfunc Interval extension F' of f'; must be thread-safe.
+ * @param a Left endpoint of the domain.
+ * @param b Right endpoint of the domain.
+ * @param MAX_ITERS Maximum subdivision depth of any branch.
+ * @param TOL Width below which an enclosure is reported.
+ * @param num_threads Number of worker threads; values <= 0 use all cores.
+ * @return Enclosures sorted by lower endpoint.
+ */
+std::vector<RootEnclosure> interval_newton(
+    const std::function<Interval(const Interval&)>& func,
+    const std::function<Interval(const Interval&)>& dfunc,
+    double a,
+    double b,
+    int MAX_ITERS,
+    double TOL,
+    int num_threads
+){
+    if (!(a < b)) {
+        throw std::invalid_argument("Interval Newton expects a < b");
+    }
+
+    std::vector<RootEnclosure> roots;
+    std::mutex roots_mutex;
+    ThreadPool pool{num_threads};
+
+    std::function<void(Interval, bool, int)> process;
+    process = [&](Interval X, bool unique, int depth) {
+        while (true) {
+            // Step 1
+            if (!func(X).contains(0.0)) {
+                return;
+            }
+
+            // Step 2
+            if (X.width() < TOL || depth >= MAX_ITERS) {
+                std::lock_guard<std::mutex> lock{roots_mutex};
+                roots.push_back({X, unique});
+                return;
+            }
+            depth += 1;
+
+            // Step 3
+            const Interval dF = dfunc(X);
+            if (!dF.contains(0.0)) {
+                const double m = X.midpoint();
+                const Interval N = Interval(m) - func(Interval(m)) / dF;
+                unique = unique || X.interior_contains(N);
+
+                // Step 4
+                Interval contracted;
+                if (!intersect(X, N, contracted)) {
+                    return;
+                }
+                const bool converging = contracted.width() <= 0.5 * X.width();
+                X = contracted;
+                if (unique || converging) {
+                    continue;
+                }
+            }
+
+            // Step 5
+            const double m = X.midpoint();
+            const Interval left{X.lower, m};
+            const Interval right{m, X.upper};
+            pool.submit([&process, right, depth] { process(right, false, depth); });
+            X = left;
+            unique = false;
         }
-        h = -2 * f_p2 / E;
-        p = p2 + h;
+    };
+
+    // Step 6
+    pool.submit([&process, a, b] { process(Interval(a, b), false, 0); });
+    pool.wait();
 
-        // Step 6
+    // Step 7
+    std::sort(roots.begin(), roots.end(), [](const RootEnclosure& lhs, const RootEnclosure& rhs) {
+        return lhs.enclosure.lower < rhs.enclosure.lower;
+    });
 
-        if (std::abs(h) < TOL){
-            return p;
+    // Step 8: a root on a bisection point is reported by both neighbours, so
+    // touching enclosures are merged and re-verified with one Newton test.
+    std::vector<RootEnclosure> merged;
+    for (const RootEnclosure& root : roots) {
+        if (merged.empty() || root.enclosure.lower > merged.back().enclosure.upper) {
+            merged.push_back(root);
+            continue;
         }
+        RootEnclosure& last = merged.back();
+        last.enclosure.upper = std::max(last.enclosure.upper, root.enclosure.upper);
+        last.unique = false;
 
-        // Step 7
-        p0 = p1;
-        p1 = p2;
-        p2 = p;
-        h1 = p1 - p0;
-        h2 = p2 - p1;
-        if (h1 == 0.0 || h2 == 0.0 || (h2 + h1) == 0.0) {
-            throw std::runtime_error("Muller's method encountered degenerate interpolation points");
+        const Interval dF = dfunc(last.enclosure);
+        if (!dF.contains(0.0)) {
+            const double m = last.enclosure.midpoint();
+            const Interval N = Interval(m) - func(Interval(m)) / dF;
+            last.unique = last.enclosure.interior_contains(N);
         }
-        d1 = (func(p1) - func(p0))/h1;
-        d2 = (func(p2) - func(p1))/h2;
-        d = (d2 - d1)/(h2 + h1);
-        iteration += 1;
     }
+    return merged;
+}
+
+namespace {
+
+/**
+ * @brief Collect the roots of f on [a, b] into roots, splitting the interval
+ * while its Chebyshev interpolant is unresolved at MAX_DEGREE.
+ *
+ * @param func Smooth function f(x).
+ * @param a Left endpoint of the interval.
+ * @param b Right endpoint of the interval.
+ * @param MAX_DEGREE Largest interpolant degree before subdividing.
+ * @param TOL Relative tolerance for the Chebyshev coefficients.
+ * @param depth Remaining number of allowed subdivisions.
+ * @param roots Destination for the roots found.
+ */
+void chebyshev_roots_recursive(
+    const std::function<double(double)>& func,
+    double a,
+    double b,
+    int MAX_DEGREE,
+    double TOL,
+    int depth,
+    std::vector<double>& roots
+){
+    const ChebyshevSeries series = chebyshev_fit(func, a, b, MAX_DEGREE, TOL);
+    if (!series.resolved && depth > 0) {
+        // Split slightly off-center so symmetric roots do not land on the break.
+        const double split = a + 0.5009765625 * (b - a);
+        chebyshev_roots_recursive(func, a, split, MAX_DEGREE, TOL, depth - 1, roots);
+        chebyshev_roots_recursive(func, split, b, MAX_DEGREE, TOL, depth - 1, roots);
+        return;
+    }
+    if (!series.resolved) {
+        std::cerr << "Chebyshev interpolant not resolved on [" << a << ", " << b << "] "
+                  << "with degree " << MAX_DEGREE << std::endl;
+    }
+    for (double root : chebyshev_series_roots(series)) {
+        roots.push_back(root);
+    }
+}
 
-    // Step 8
-    std::cerr << "Muller's Method failed after " << MAX_ITERS << " iterations." << std::endl;
-    return p;
+}  // namespace
+
+/**
+ * @brief Find every root of f(x) = 0 on [a, b] from a Chebyshev proxy.
+ *
+ * @param func Smooth function f(x).
+ * @param a Left endpoint of the interval.
+ * @param b Right endpoint of the interval.
+ * @param MAX_DEGREE Largest interpolant degree before subdividing.
+ * @param TOL Relative tolerance for the Chebyshev coefficients.
+ * @return Sorted roots in [a, b].
+ */
+std::vector<double> chebyshev_roots(
+    const std::function<double(double)>& func,
+    double a,
+    double b,
+    int MAX_DEGREE,
+    double TOL
+){
+    // Step 1
+    std::vector<double> roots;
+    chebyshev_roots_recursive(func, a, b, MAX_DEGREE, TOL, 24, roots);
+
+    // Step 2: roots on a split point are found by both halves.
+    std::sort(roots.begin(), roots.end());
+    std::vector<double> unique_roots;
+    for (double root : roots) {
+        if (unique_roots.empty() || root - unique_roots.back() > 1e-10 * (b - a)) {
+            unique_roots.push_back(root);
+        }
+    }
+    return unique_roots;
 }
@@ -0,0 +1,402 @@
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "numeric/root_approximation.hpp"
+#include "numeric/solution_cache.hpp"
+
+namespace {
+
+/**
+ * @brief Largest dimension for which the 3^d cells around a query are scanned;
+ * in higher dimensions only the query cell is searched.
+ */
+constexpr int MAX_NEIGHBOUR_DIMENSION = 6;
+
+/**
+ * @brief Result reported for an exact cache hit.
+ *
+ * @param root Cached root.
+ * @return Converged result with no iterations or evaluations.
+ */
+SolveResult exact_hit(double root){
+    SolveResult result;
+    result.root = root;
+    result.status = SolveStatus::CONVERGED;
+    return result;
+}
+
+}  // namespace
+
+/**
+ * @brief Construct an empty cache.
+ *
+ * @param dimension Length of every parameter vector.
+ * @param cell_size Side of a grid cell.
+ * @param capacity Maximum number of stored roots.
+ */
+SolutionCache::SolutionCache(int dimension, double cell_size, int capacity) : dimension_(dimension), cell_size_(cell_size), capacity_(capacity) {
+    if (dimension < 1) {
+        throw std::invalid_argument("Solution cache expects a positive dimension");
+    }
+    if (!(cell_size > 0.0)) {
+        throw std::invalid_argument("Solution cache expects a positive cell size");
+    }
+    if (capacity < 1) {
+        throw std::invalid_argument("Solution cache expects a positive capacity");
+    }
+}
+
+/**
+ * @brief Combine the cell indices into one hash.
+ *
+ * @param cell Integer grid coordinates.
+ * @return Hash value.
+ */
+std::size_t SolutionCache::CellHash::operator()(const std::vector<long long>& cell) const {
+    std::size_t seed = cell.size();
+    for (long long index : cell) {
+        seed ^= std::hash<long long>{}(index) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+/**
+ * @brief Grid cell containing params.
+ *
+ * @param params Parameter vector p.
+ * @return Integer grid coordinates.
+ */
+std::vector<long long> SolutionCache::cell_of(const std::vector<double>& params) const {
+    if (static_cast<int>(params.size()) != dimension_) {
+        throw std::invalid_argument("Solution cache parameter vector has the wrong dimension");
+    }
+    std::vector<long long> cell;
+    cell.reserve(dimension_);
+    for (double value : params) {
+        if (!std::isfinite(value)) {
+            throw std::invalid_argument("Solution cache parameters must be finite");
+        }
+        cell.push_back(static_cast<long long>(std::floor(value / cell_size_)));
+    }
+    return cell;
+}
+
+/**
+ * @brief Find the cached root nearest to params and mark it recently used.
+ *
+ * @param params Parameter vector p.
+ * @param root Destination for the nearest cached root.
+ * @param exact Set to whether the entry matches params exactly.
+ * @return Whether any entry lies in the neighbouring cells.
+ */
+bool SolutionCache::nearest(const std::vector<double>& params, double& root, bool& exact){
+    const std::vector<long long> center = cell_of(params);
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    std::list<Entry>::iterator best = entries_.end();
+    double best_distance = std::numeric_limits<double>::infinity();
+    const auto scan = [&](const std::vector<long long>& cell) {
+        const auto found = cells_.find(cell);
+        if (found == cells_.end()) {
+            return;
+        }
+        for (const std::list<Entry>::iterator& entry : found->second) {
+            double distance = 0.0;
+            for (int ii = 0; ii < dimension_; ii++) {
+                const double delta = entry->params[ii] - params[ii];
+                distance += delta * delta;
+            }
+            if (distance < best_distance) {
+                best_distance = distance;
+                best = entry;
+            }
+        }
+    };
+
+    if (dimension_ > MAX_NEIGHBOUR_DIMENSION) {
+        scan(center);
+    } else {
+        // Visit the 3^d cells around center by counting in base 3.
+        std::vector<int> offset;
+        offset.assign(dimension_, -1);
+        std::vector<long long> cell = center;
+        while (true) {
+            for (int ii = 0; ii < dimension_; ii++) {
+                cell[ii] = center[ii] + offset[ii];
+            }
+            scan(cell);
+            int digit = 0;
+            while (digit < dimension_ && offset[digit] == 1) {
+                offset[digit] = -1;
+                digit += 1;
+            }
+            if (digit == dimension_) {
+                break;
+            }
+            offset[digit] += 1;
+        }
+    }
+
+    if (best == entries_.end()) {
+        return false;
+    }
+    entries_.splice(entries_.begin(), entries_, best);
+    root = best->root;
+    exact = best_distance == 0.0 && best->params == params;
+    return true;
+}
+
+/**
+ * @brief Store a root, replacing any entry with identical parameters and
+ * evicting the least recently used entry when full.
+ *
+ * @param params Parameter vector p.
+ * @param root Root of f(p, x) = 0.
+ */
+void SolutionCache::insert(const std::vector<double>& params, double root){
+    std::vector<long long> cell = cell_of(params);
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    std::vector<std::list<Entry>::iterator>& bucket = cells_[cell];
+    for (const std::list<Entry>::iterator& entry : bucket) {
+        if (entry->params == params) {
+            entry->root = root;
+            entries_.splice(entries_.begin(), entries_, entry);
+            return;
+        }
+    }
+    entries_.push_front(Entry{params, std::move(cell), root});
+    bucket.push_back(entries_.begin());
+
+    if (static_cast<int>(entries_.size()) > capacity_) {
+        const std::list<Entry>::iterator oldest = std::prev(entries_.end());
+        const auto found = cells_.find(oldest->cell);
+        std::vector<std::list<Entry>::iterator>& oldest_bucket = found->second;
+        for (std::size_t ii = 0; ii < oldest_bucket.size(); ii++) {
+            if (oldest_bucket[ii] == oldest) {
+                oldest_bucket[ii] = oldest_bucket.back();
+                oldest_bucket.pop_back();
+                break;
+            }
+        }
+        if (oldest_bucket.empty()) {
+            cells_.erase(found);
+        }
+        entries_.erase(oldest);
+    }
+}
+
+/**
+ * @brief Look up the warm start for a solve and update the counters.
+ *
+ * @param params Parameter vector p.
+ * @param root Destination for the cached root.
+ * @return 0 on a miss, 1 on a warm start and 2 on an exact hit.
+ */
+int SolutionCache::lookup(const std::vector<double>& params, double& root){
+    bool exact = false;
+    const bool found = nearest(params, root, exact);
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (!found) {
+        misses_ += 1;
+        return 0;
+    }
+    if (!exact) {
+        warm_starts_ += 1;
+        return 1;
+    }
+    hits_ += 1;
+    return 2;
+}
+
+/**
+ * @brief Approximate a root of f(p, x) = 0 with the Newton-Raphson method,
+ * starting from the nearest cached root when one exists.
+ *
+ * @param func Continuous function f(p, x).
+ * @param params Parameter vector p.
+ * @param x0 Initial approximation used on a cache miss.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(p, x) = 0.
+ */
+double SolutionCache::newton_method(
+    const std::function<double(const std::vector<double>&, double)>& func,
+    const std::vector<double>& params,
+    double x0,
+    int MAX_ITERS,
+    double TOL
+){
+    SolveOptions options;
+    options.max_iters = MAX_ITERS;
+    options.tol = TOL;
+    return newton_method(func, params, x0, options).root;
+}
+
+/**
+ * @brief Approximate a root of f(p, x) = 0 with the Secant method, starting
+ * from the nearest cached root when one exists.
+ *
+ * @param func Continuous function f(p, x).
+ * @param params Parameter vector p.
+ * @param x0 First initial approximation used on a cache miss.
+ * @param x1 Second initial approximation used on a cache miss.
+ * @param MAX_ITERS Maximum number of iterations.
+ * @param TOL Convergence tolerance.
+ * @return Approximate x to solution f(p, x) = 0.
+ */
+double SolutionCache::secant_method(
+    const std::function<double(const std::vector<double>&, double)>& func,
+    const std::vector<double>& params,
+    double x0,
+    double x1,
+    int MAX_ITERS,
+    double TOL
+){
+    SolveOptions options;
+    options.max_iters = MAX_ITERS;
+    options.tol = TOL;
+    return secant_method(func, params, x0, x1, options).root;
+}
+
+/**
+ * @brief Approximate a root of f(p, x) = 0 with the Newton-Raphson method
+ * under solve options, starting from the nearest cached root when one exists.
+ *
+ * @param func Continuous function f(p, x).
+ * @param params Parameter vector p.
+ * @param x0 Initial approximation used on a cache miss.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result.
+ */
+SolveResult SolutionCache::newton_method(
+    const std::function<double(const std::vector<double>&, double)>& func,
+    const std::vector<double>& params,
+    double x0,
+    const SolveOptions& options
+){
+    double cached = 0.0;
+    const int status = lookup(params, cached);
+    if (status == 2) {
+        return exact_hit(cached);
+    }
+    if (status == 1) {
+        x0 = cached;
+    }
+
+    const std::function<double(double)> bound = [&func, &params](double x) {
+        return func(params, x);
+    };
+    const SolveResult result = ::newton_method(bound, x0, options);
+    if (result.status == SolveStatus::CONVERGED) {
+        insert(params, result.root);
+    }
+    return result;
+}
+
+/**
+ * @brief Approximate a root of f(p, x) = 0 with the Secant method under solve
+ * options, starting from the nearest cached root when one exists.
+ *
+ * @param func Continuous function f(p, x).
+ * @param params Parameter vector p.
+ * @param x0 First initial approximation used on a cache miss.
+ * @param x1 Second initial approximation used on a cache miss.
+ * @param options Iteration, tolerance and resource limits.
+ * @return Solve result.
+ */
+SolveResult SolutionCache::secant_method(
+    const std::function<double(const std::vector<double>&, double)>& func,
+    const std::vector<double>& params,
+    double x0,
+    double x1,
+    const SolveOptions& options
+){
+    double cached = 0.0;
+    const int status = lookup(params, cached);
+    if (status == 2) {
+        return exact_hit(cached);
+    }
+    if (status == 1) {
+        x0 = cached;
+        x1 = cached + 1e-3 * (1.0 + std::abs(cached));
+    }
+
+    const std::function<double(double)> bound = [&func, &params](double x) {
+        return func(params, x);
+    };
+    const SolveResult result = ::secant_method(bound, x0, x1, options);
+    if (result.status == SolveStatus::CONVERGED) {
+        insert(params, result.root);
+    }
+    return result;
+}
+
+/**
+ * @brief Remove every entry and reset the counters.
+ */
+void SolutionCache::clear(){
+    std::lock_guard<std::mutex> lock{mutex_};
+    entries_.clear();
+    cells_.clear();
+    hits_ = 0;
+    warm_starts_ = 0;
+    misses_ = 0;
+}
+
+/**
+ * @brief Number of stored roots.
+ *
+ * @return Entry count.
+ */
+int SolutionCache::size() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return static_cast<int>(entries_.size());
+}
+
+/**
+ * @brief Number of solves answered by an exact match.
+ *
+ * @return Hit count.
+ */
+long long SolutionCache::hits() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return hits_;
+}
+
+/**
+ * @brief Number of solves started from a neighbouring cached root.
+ *
+ * @return Warm start count.
+ */
+long long SolutionCache::warm_starts() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return warm_starts_;
+}
+
+/**
+ * @brief Number of solves started from the caller's approximation.
+ *
+ * @return Miss count.
+ */
+long long SolutionCache::misses() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return misses_;
+}
+
+/**
+ * @brief Fraction of solves answered by an exact match.
+ *
+ * @return hits / (hits + warm_starts + misses), or 0 before any solve.
+ */
+double SolutionCache::hit_rate() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    const long long total = hits_ + warm_starts_ + misses_;
+    return total == 0 ? 0.0 : static_cast<double>(hits_) / total;
+}
@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include "numeric/solve_options.hpp"
+
+/**
+ * @brief Create a token that has not been cancelled.
+ */
+CancellationToken::CancellationToken() : flag_(std::make_shared<std::atomic<bool>>(false)) {}
+
+/**
+ * @brief Request cancellation.
+ */
+void CancellationToken::cancel() const {
+    flag_->store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Whether cancellation was requested.
+ *
+ * @return Cancellation state.
+ */
+bool CancellationToken::cancelled() const {
+    return flag_->load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Set the deadline relative to now.
+ *
+ * @param seconds Wall-clock budget in seconds.
+ */
+void SolveOptions::set_timeout(double seconds){
+    deadline = std::chrono::steady_clock::now()
+        + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+}
+
+/**
+ * @brief Start monitoring a solve.
+ *
+ * @param options Limits to enforce; must outlive the monitor.
+ * @param x0 Estimate reported if the solve stops before any evaluation.
+ */
+EvaluationMonitor::EvaluationMonitor(const SolveOptions& options, double x0) : options_(options), best_x_(x0) {}
+
+/**
+ * @brief Throw SolveInterrupted if any limit has been reached.
+ */
+void EvaluationMonitor::check() const {
+    if (options_.cancellation && options_.cancellation->cancelled()) {
+        throw SolveInterrupted{SolveStatus::CANCELLED};
+    }
+    if (options_.max_evaluations > 0 && evaluations_ >= options_.max_evaluations) {
+        throw SolveInterrupted{SolveStatus::BUDGET_EXHAUSTED};
+    }
+    if (options_.deadline != std::chrono::steady_clock::time_point::max()
+        && std::chrono::steady_clock::now() >= options_.deadline) {
+        throw SolveInterrupted{SolveStatus::DEADLINE_EXCEEDED};
+    }
+}
+
+/**
+ * @brief Record an evaluated point. A bracket is opened when the residual
+ * changes sign against the previous or the best point, and afterwards only
+ * shrinks.
+ *
+ * @param x Point of evaluation.
+ * @param residual Signed residual at x, e.g. f(x).
+ */
+void EvaluationMonitor::record(double x, double residual){
+    if (std::isnan(residual)) {
+        return;
+    }
+    const double previous_best_x = best_x_;
+    const double previous_best_residual = best_residual_;
+    if (std::abs(residual) < best_residual_) {
+        best_residual_ = std::abs(residual);
+        best_x_ = x;
+    }
+
+    if (has_bracket_) {
+        if (x > lower_ && x < upper_) {
+            if ((residual < 0.0) == (residual_lower_ < 0.0)) {
+                lower_ = x;
+                residual_lower_ = residual;
+            } else {
+                upper_ = x;
+            }
+        }
+    } else {
+        const auto open = [this, x, residual](double other, double other_residual) {
+            if (has_bracket_ || residual * other_residual >= 0.0 || x == other) {
+                return;
+            }
+            has_bracket_ = true;
+            lower_ = std::min(x, other);
+            upper_ = std::max(x, other);
+            residual_lower_ = x < other ? residual : other_residual;
+        };
+        if (has_last_) {
+            open(last_x_, last_residual_);
+        }
+        if (std::isfinite(previous_best_residual)) {
+            open(previous_best_x, previous_best_residual);
+        }
+    }
+    has_last_ = true;
+    last_x_ = x;
+    last_residual_ = residual;
+}
+
+/**
+ * @brief Check the limits, evaluate f(x) and record it.
+ *
+ * @param func Function f(x).
+ * @param x Point of evaluation.
+ * @return f(x).
+ */
+double EvaluationMonitor::evaluate(const std::function<double(double)>& func, double x){
+    check();
+    evaluations_ += 1;
+    const double f_x = func(x);
+    record(x, f_x);
+    return f_x;
+}
+
+/**
+ * @brief Check the limits, evaluate f(x) and f'(x) with one call and record
+ * f(x).
+ *
+ * @param func Function returning the tuple (f(x), f'(x)).
+ * @param x Point of evaluation.
+ * @return Tuple of f(x) and f'(x).
+ */
+std::tuple<double, double> EvaluationMonitor::evaluate_derivative(
+    const std::function<std::tuple<double, double>(double)>& func,
+    double x
+){
+    check();
+    evaluations_ += 1;
+    const std::tuple<double, double> value = func(x);
+    record(x, std::get<0>(value));
+    return value;
+}
+
+/**
+ * @brief Check the limits, evaluate g(x) for a fixed-point problem and record
+ * the residual g(x) - x.
+ *
+ * @param func Function g(x).
+ * @param x Point of evaluation.
+ * @return g(x).
+ */
+double EvaluationMonitor::evaluate_fixed_point(const std::function<double(double)>& func, double x){
+    check();
+    evaluations_ += 1;
+    const double g_x = func(x);
+    record(x, g_x - x);
+    return g_x;
+}
+
+/**
+ * @brief Result of a solve that ran to completion.
+ *
+ * @param root Final approximation.
+ * @param status CONVERGED or MAX_ITERATIONS.
+ * @param iterations Iterations performed.
+ * @param error Final convergence measure.
+ * @return Solve result.
+ */
+SolveResult EvaluationMonitor::finish(double root, SolveStatus status, int iterations, double error) const {
+    SolveResult result;
+    result.root = root;
+    result.status = status;
+    result.iterations = iterations;
+    result.evaluations = evaluations_;
+    result.residual = best_residual_;
+    result.error = error;
+    if (has_bracket_) {
+        result.bracket_lower = lower_;
+        result.bracket_upper = upper_;
+    }
+    return result;
+}
+
+/**
+ * @brief Result of a solve stopped by a limit, reporting the best evaluated
+ * point.
+ *
+ * @param interrupt Exception carrying the reason.
+ * @param iterations Iterations performed.
+ * @return Solve result.
+ */
+SolveResult EvaluationMonitor::interrupted(const SolveInterrupted& interrupt, int iterations) const {
+    SolveResult result = finish(best_x_, interrupt.status, iterations, std::numeric_limits<double>::quiet_NaN());
+    if (has_bracket_) {
+        result.error = 0.5 * (upper_ - lower_);
+    }
+    return result;
+}
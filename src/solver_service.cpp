@@ -0,0 +1,739 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+#include "numeric/solver_service.hpp"
+
+namespace {
+
+/**
+ * @brief Records solved by one thread-pool task. Large requests are split
+ * into blocks of this size so that they spread over the worker threads.
+ */
+constexpr long long BLOCK_RECORDS = 256;
+
+/**
+ * @brief Number of compiled expressions kept before the cache is cleared.
+ */
+constexpr std::size_t MAX_CACHED_EXPRESSIONS = 1024;
+
+/**
+ * @brief Build the message for a failed system call.
+ *
+ * @param action What was attempted.
+ * @return Message including the system error description.
+ */
+std::string system_error_message(const std::string& action){
+    return "Could not " + action + ": " + std::strerror(errno);
+}
+
+/**
+ * @brief Address of a Unix domain socket.
+ *
+ * @param path Filesystem path of the socket.
+ * @return Socket address.
+ */
+sockaddr_un socket_address(const std::string& path){
+    sockaddr_un address{};
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path must be between 1 and " + std::to_string(sizeof(address.sun_path) - 1) + " characters");
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+/**
+ * @brief Read exactly length bytes from a socket.
+ *
+ * @param socket Connected socket.
+ * @param data Destination buffer.
+ * @param length Number of bytes to read.
+ * @return Whether every byte was read before the peer closed the socket.
+ */
+bool read_all(int socket, void* data, std::size_t length){
+    unsigned char* bytes = static_cast<unsigned char*>(data);
+    while (length > 0) {
+        const ssize_t received = recv(socket, bytes, length, 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        bytes += received;
+        length -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+
+/**
+ * @brief Write exactly length bytes to a socket without raising SIGPIPE.
+ *
+ * @param socket Connected socket.
+ * @param data Source buffer.
+ * @param length Number of bytes to write.
+ * @return Whether every byte was written.
+ */
+bool write_all(int socket, const void* data, std::size_t length){
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    while (length > 0) {
+        const ssize_t sent = send(socket, bytes, length, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent <= 0) {
+            return false;
+        }
+        bytes += sent;
+        length -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+/**
+ * @brief Send a response header and optional error message as one write.
+ *
+ * @param socket Connected socket.
+ * @param write_mutex Mutex serialising writes to the socket.
+ * @param response Response header; message_length is filled in.
+ * @param message Error message, empty on success.
+ */
+void send_response(int socket, std::mutex& write_mutex, ServiceResponse response, const std::string& message){
+    response.message_length = static_cast<std::uint32_t>(message.size());
+    std::string buffer{reinterpret_cast<const char*>(&response), sizeof(response)};
+    buffer += message;
+    const std::lock_guard<std::mutex> lock{write_mutex};
+    write_all(socket, buffer.data(), buffer.size());
+}
+
+/**
+ * @brief Receive the hello message and the file descriptor attached to it.
+ *
+ * @param socket Connected socket.
+ * @param hello Destination for the hello message.
+ * @param descriptor Destination for the received descriptor, or -1.
+ * @return Whether a complete hello message was received.
+ */
+bool receive_hello(int socket, ServiceHello& hello, int& descriptor){
+    descriptor = -1;
+    iovec data{&hello, sizeof(hello)};
+    alignas(cmsghdr) unsigned char control[CMSG_SPACE(sizeof(int))];
+    msghdr message{};
+    message.msg_iov = &data;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    ssize_t received = -1;
+    do {
+        received = recvmsg(socket, &message, MSG_WAITALL | MSG_CMSG_CLOEXEC);
+    } while (received < 0 && errno == EINTR);
+
+    for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header)) {
+        if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS) {
+            std::memcpy(&descriptor, CMSG_DATA(header), sizeof(int));
+        }
+    }
+    return received == static_cast<ssize_t>(sizeof(hello));
+}
+
+/**
+ * @brief Send the hello message with a file descriptor attached.
+ *
+ * @param socket Connected socket.
+ * @param hello Hello message.
+ * @param descriptor Descriptor of the shared-memory region.
+ * @return Whether the message was sent.
+ */
+bool send_hello(int socket, const ServiceHello& hello, int descriptor){
+    iovec data{const_cast<ServiceHello*>(&hello), sizeof(hello)};
+    alignas(cmsghdr) unsigned char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message{};
+    message.msg_iov = &data;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(header), &descriptor, sizeof(int));
+
+    ssize_t sent = -1;
+    do {
+        sent = sendmsg(socket, &message, MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    return sent == static_cast<ssize_t>(sizeof(hello));
+}
+
+/**
+ * @brief Create an anonymous shared-memory region sealed against shrinking,
+ * so the server can map it without the client truncating it under a running
+ * solve.
+ *
+ * @param size Size of the region in bytes.
+ * @return File descriptor of the region.
+ */
+int create_shared_memory(std::size_t size){
+    const int descriptor = memfd_create("numeric-solver", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (descriptor < 0) {
+        throw std::runtime_error(system_error_message("create shared memory"));
+    }
+    if (ftruncate(descriptor, static_cast<off_t>(size)) != 0
+        || fcntl(descriptor, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_SEAL) != 0) {
+        const std::string message = system_error_message("size and seal shared memory");
+        close(descriptor);
+        throw std::runtime_error(message);
+    }
+    return descriptor;
+}
+
+}  // namespace
+
+/**
+ * @brief Client connection and the ring it shared with the server.
+ */
+struct SolverServer::Connection {
+    int socket = -1;
+    unsigned char* ring = nullptr;
+    std::size_t ring_bytes = 0;
+    std::uint32_t slots = 0;
+    std::uint64_t slot_bytes = 0;
+    std::mutex write_mutex;
+
+    /**
+     * @brief Unmap the ring and close the socket.
+     */
+    ~Connection(){
+        if (ring != nullptr) {
+            munmap(ring, ring_bytes);
+        }
+        if (socket >= 0) {
+            close(socket);
+        }
+    }
+};
+
+/**
+ * @brief Request being solved, shared by the tasks of its blocks.
+ */
+struct SolverServer::Job {
+    std::shared_ptr<Connection> connection;
+    std::shared_ptr<const CompiledExpression> func;
+    ServiceRequest request{};
+    SolveOptions options;
+    std::atomic<long long> remaining{0};
+    std::atomic<long long> converged{0};
+    std::atomic<long long> evaluations{0};
+    std::mutex error_mutex;
+    std::string error;
+};
+
+/**
+ * @brief Bind and listen on a Unix domain socket, replacing any stale socket
+ * file at the same path.
+ *
+ * @param socket_path Filesystem path of the socket.
+ * @param num_threads Number of worker threads; 0 uses all hardware threads.
+ */
+SolverServer::SolverServer(const std::string& socket_path, int num_threads) : socket_path_(socket_path), pool_(num_threads) {
+    const sockaddr_un address = socket_address(socket_path);
+    const sockaddr* generic = reinterpret_cast<const sockaddr*>(&address);
+
+    // A socket file that refuses connections is left over from a server that
+    // did not shut down cleanly.
+    const int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probe >= 0) {
+        const bool live = connect(probe, generic, sizeof(address)) == 0;
+        close(probe);
+        if (live) {
+            throw std::runtime_error("A solver server is already listening on " + socket_path);
+        }
+    }
+    unlink(socket_path.c_str());
+
+    listener_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listener_ < 0) {
+        throw std::runtime_error(system_error_message("create socket"));
+    }
+    if (bind(listener_, generic, sizeof(address)) != 0 || listen(listener_, SOMAXCONN) != 0) {
+        const std::string message = system_error_message("listen on " + socket_path);
+        close(listener_);
+        throw std::runtime_error(message);
+    }
+}
+
+/**
+ * @brief Stop serving, wait for the connection threads and remove the socket
+ * file. Blocks already queued are finished by the thread pool.
+ */
+SolverServer::~SolverServer(){
+    stop();
+    {
+        std::unique_lock<std::mutex> lock{connections_mutex_};
+        readers_finished_.wait(lock, [this] { return active_readers_ == 0; });
+    }
+    close(listener_);
+    unlink(socket_path_.c_str());
+}
+
+/**
+ * @brief Accept and serve connections until stop() is called. Each
+ * connection is read by its own thread; solving happens on the pool.
+ */
+void SolverServer::run(){
+    while (!stopping_) {
+        const int client = accept4(listener_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client < 0) {
+            if (stopping_) {
+                break;
+            }
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            throw std::runtime_error(system_error_message("accept connection"));
+        }
+
+        auto connection = std::make_shared<Connection>();
+        connection->socket = client;
+
+        const std::lock_guard<std::mutex> lock{connections_mutex_};
+        if (stopping_) {
+            break;
+        }
+        connections_.erase(
+            std::remove_if(connections_.begin(), connections_.end(), [](const std::weak_ptr<Connection>& entry) {
+                return entry.expired();
+            }),
+            connections_.end()
+        );
+        connections_.push_back(connection);
+        active_readers_ += 1;
+        std::thread{[this, connection] {
+            serve(connection);
+            const std::lock_guard<std::mutex> reader_lock{connections_mutex_};
+            active_readers_ -= 1;
+            readers_finished_.notify_all();
+        }}.detach();
+    }
+}
+
+/**
+ * @brief Make run() return and close every connection. Safe to call from any
+ * thread.
+ */
+void SolverServer::stop(){
+    stopping_ = true;
+    shutdown(listener_, SHUT_RDWR);
+    const std::lock_guard<std::mutex> lock{connections_mutex_};
+    for (const std::weak_ptr<Connection>& entry : connections_) {
+        if (const std::shared_ptr<Connection> connection = entry.lock()) {
+            shutdown(connection->socket, SHUT_RDWR);
+        }
+    }
+}
+
+/**
+ * @brief Number of records solved since the server started.
+ *
+ * @return Record count.
+ */
+long long SolverServer::records_solved() const {
+    return records_solved_;
+}
+
+/**
+ * @brief Receive the hello message, map the client's ring and serve its
+ * requests until the client disconnects. Malformed messages close the
+ * connection.
+ *
+ * @param connection Connection to serve.
+ */
+void SolverServer::serve(const std::shared_ptr<Connection>& connection){
+    ServiceHello hello{};
+    int descriptor = -1;
+    const bool received = receive_hello(connection->socket, hello, descriptor);
+    const bool valid = received && descriptor >= 0 && hello.version == SERVICE_PROTOCOL_VERSION && hello.slots > 0
+        && hello.slot_bytes > 0 && hello.slot_bytes % sizeof(double) == 0
+        && hello.slot_bytes <= SIZE_MAX / hello.slots;
+    // Only a ring sealed against shrinking is mapped: a client truncating an
+    // unsealed one would make the workers fault with SIGBUS mid-solve.
+    const int seals = valid ? fcntl(descriptor, F_GET_SEALS) : -1;
+    const bool sealed = seals >= 0 && (seals & F_SEAL_SHRINK) != 0;
+    struct stat status{};
+    if (!sealed || fstat(descriptor, &status) != 0
+        || static_cast<std::uint64_t>(status.st_size) < hello.slots * hello.slot_bytes) {
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
+        return;
+    }
+
+    const std::size_t ring_bytes = static_cast<std::size_t>(hello.slots * hello.slot_bytes);
+    void* address = mmap(nullptr, ring_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if (address == MAP_FAILED) {
+        return;
+    }
+    connection->ring = static_cast<unsigned char*>(address);
+    connection->ring_bytes = ring_bytes;
+    connection->slots = hello.slots;
+    connection->slot_bytes = hello.slot_bytes;
+
+    ServiceRequest request{};
+    std::string source;
+    while (read_all(connection->socket, &request, sizeof(request))) {
+        if (request.source_length > SERVICE_MAX_SOURCE_LENGTH) {
+            break;
+        }
+        source.resize(request.source_length);
+        if (!read_all(connection->socket, &source[0], source.size())) {
+            break;
+        }
+        dispatch(connection, request, source);
+    }
+}
+
+/**
+ * @brief Validate a request and submit its blocks to the thread pool. Invalid
+ * requests are answered immediately with an error message.
+ *
+ * @param connection Connection the request arrived on.
+ * @param request Request header.
+ * @param source Expression source.
+ */
+void SolverServer::dispatch(const std::shared_ptr<Connection>& connection, const ServiceRequest& request, const std::string& source){
+    ServiceResponse response{};
+    response.id = request.id;
+
+    std::string error;
+    std::shared_ptr<const CompiledExpression> func;
+    try {
+        // The parser rejects sources nested deeper than
+        // CompiledExpression::MAX_DEPTH, so a hostile source is answered with
+        // an error instead of exhausting this thread's stack.
+        func = compile(source);
+    } catch (const std::exception& exception) {
+        error = exception.what();
+    }
+    if (error.empty()) {
+        const std::uint64_t bytes = static_cast<std::uint64_t>(request.count) * (request.width * sizeof(double) + sizeof(StreamRecord));
+        if (request.slot >= connection->slots) {
+            error = "Request names slot " + std::to_string(request.slot) + " of a ring with " + std::to_string(connection->slots) + " slots";
+        } else if (request.width != static_cast<std::uint32_t>(func->parameter_count() + 1)) {
+            error = "Expression expects " + std::to_string(func->parameter_count()) + " parameters per record";
+        } else if (bytes > connection->slot_bytes) {
+            error = "Request of " + std::to_string(bytes) + " bytes does not fit a slot";
+        } else if (request.method > static_cast<std::uint32_t>(StreamMethod::SECANT)) {
+            error = "Unknown solver method " + std::to_string(request.method);
+        }
+    }
+    if (!error.empty() || request.count == 0) {
+        send_response(connection->socket, connection->write_mutex, response, error);
+        return;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->connection = connection;
+    job->func = std::move(func);
+    job->request = request;
+    job->options.max_iters = request.max_iters;
+    job->options.tol = request.tol;
+    job->options.max_evaluations = request.max_evaluations;
+
+    const long long blocks = (request.count + BLOCK_RECORDS - 1) / BLOCK_RECORDS;
+    job->remaining = blocks;
+    for (long long block = 0; block < blocks; block++) {
+        pool_.submit([this, job, block] { solve_block(job, block); });
+    }
+}
+
+/**
+ * @brief Solve one block of a request on a worker thread, and send the
+ * response once every block has finished.
+ *
+ * @param job Request being solved.
+ * @param block Index of the block.
+ */
+void SolverServer::solve_block(const std::shared_ptr<Job>& job, long long block){
+    const ServiceRequest& request = job->request;
+    const long long lo = block * BLOCK_RECORDS;
+    const long long hi = std::min<long long>(lo + BLOCK_RECORDS, request.count);
+
+    unsigned char* slot = job->connection->ring + request.slot * job->connection->slot_bytes;
+    const double* records = reinterpret_cast<const double*>(slot);
+    StreamRecord* results = reinterpret_cast<StreamRecord*>(slot + static_cast<std::size_t>(request.count) * request.width * sizeof(double));
+    try {
+        const StreamStatistics statistics = solve_records(
+            *job->func, records + lo * request.width, hi - lo, results + lo, static_cast<StreamMethod>(request.method), job->options
+        );
+        job->converged += statistics.converged;
+        job->evaluations += statistics.evaluations;
+        records_solved_ += hi - lo;
+    } catch (const std::exception& exception) {
+        const std::lock_guard<std::mutex> lock{job->error_mutex};
+        if (job->error.empty()) {
+            job->error = exception.what();
+        }
+    }
+
+    if (--job->remaining == 0) {
+        ServiceResponse response{};
+        response.id = request.id;
+        response.converged = job->converged;
+        response.evaluations = job->evaluations;
+        send_response(job->connection->socket, job->connection->write_mutex, response, job->error);
+    }
+}
+
+/**
+ * @brief Compiled expression for source, compiling and caching it on first
+ * use. The cache is cleared once it holds MAX_CACHED_EXPRESSIONS entries.
+ *
+ * @param source Expression source.
+ * @return Shared compiled expression.
+ */
+std::shared_ptr<const CompiledExpression> SolverServer::compile(const std::string& source){
+    const std::lock_guard<std::mutex> lock{cache_mutex_};
+    const auto found = cache_.find(source);
+    if (found != cache_.end()) {
+        return found->second;
+    }
+    auto func = std::make_shared<const CompiledExpression>(source);
+    if (cache_.size() >= MAX_CACHED_EXPRESSIONS) {
+        cache_.clear();
+    }
+    cache_.emplace(source, func);
+    return func;
+}
+
+/**
+ * @brief Connect to a server and share a ring of slots with it.
+ *
+ * @param socket_path Filesystem path of the server socket.
+ * @param slots Number of requests that may be in flight.
+ * @param slot_bytes Size of each slot; must be a multiple of 8.
+ */
+SolverClient::SolverClient(const std::string& socket_path, int slots, std::size_t slot_bytes) : slot_bytes_(slot_bytes) {
+    if (slots < 1) {
+        throw std::invalid_argument("Solver client expects at least one slot");
+    }
+    if (slot_bytes == 0 || slot_bytes % sizeof(double) != 0) {
+        throw std::invalid_argument("Solver client expects a positive slot size that is a multiple of 8 bytes");
+    }
+    const sockaddr_un address = socket_address(socket_path);
+
+    socket_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (socket_ < 0) {
+        throw std::runtime_error(system_error_message("create socket"));
+    }
+    if (connect(socket_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        const std::string message = system_error_message("connect to " + socket_path);
+        close(socket_);
+        throw std::runtime_error(message);
+    }
+
+    ring_bytes_ = slots * slot_bytes;
+    int descriptor = -1;
+    try {
+        descriptor = create_shared_memory(ring_bytes_);
+    } catch (...) {
+        close(socket_);
+        throw;
+    }
+    void* ring = mmap(nullptr, ring_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    const ServiceHello hello{SERVICE_PROTOCOL_VERSION, static_cast<std::uint32_t>(slots), slot_bytes};
+    const bool sent = ring != MAP_FAILED && send_hello(socket_, hello, descriptor);
+    const std::string message = system_error_message("share memory with " + socket_path);
+    close(descriptor);
+    if (!sent) {
+        if (ring != MAP_FAILED) {
+            munmap(ring, ring_bytes_);
+        }
+        close(socket_);
+        throw std::runtime_error(message);
+    }
+    ring_ = static_cast<unsigned char*>(ring);
+
+    for (int slot = slots - 1; slot >= 0; slot--) {
+        free_slots_.push_back(slot);
+    }
+}
+
+/**
+ * @brief Close the connection and unmap the ring.
+ */
+SolverClient::~SolverClient(){
+    close(socket_);
+    munmap(ring_, ring_bytes_);
+}
+
+/**
+ * @brief Send a batch of parametrized problems f(p, x) = 0 to the server,
+ * waiting for a response first if every slot is in flight.
+ *
+ * @param source Expression source, as accepted by CompiledExpression.
+ * @param x0 Initial approximations, one per problem.
+ * @param params No parameter sets, one shared by every problem, or one per
+ * problem.
+ * @param method Solver applied to each problem.
+ * @param options Per-problem iteration, tolerance and evaluation limits.
+ * @return Request identifier for wait().
+ */
+std::uint64_t SolverClient::submit(
+    const std::string& source,
+    const std::vector<double>& x0,
+    const std::vector<std::vector<double>>& params,
+    StreamMethod method,
+    const SolveOptions& options
+){
+    if (params.size() > 1 && params.size() != x0.size()) {
+        throw std::invalid_argument("Batch expects no parameter sets, one, or one per initial approximation");
+    }
+    const std::size_t width = params.empty() ? 1 : params[0].size() + 1;
+    for (const std::vector<double>& p : params) {
+        if (p.size() + 1 != width) {
+            throw std::invalid_argument("Every parameter set must have the same length");
+        }
+    }
+    if (source.size() > SERVICE_MAX_SOURCE_LENGTH) {
+        throw std::invalid_argument("Expression source exceeds " + std::to_string(SERVICE_MAX_SOURCE_LENGTH) + " characters");
+    }
+    const std::size_t bytes = x0.size() * (width * sizeof(double) + sizeof(StreamRecord));
+    if (bytes > slot_bytes_) {
+        throw std::invalid_argument(
+            "Request of " + std::to_string(bytes) + " bytes does not fit a slot of " + std::to_string(slot_bytes_) + " bytes"
+        );
+    }
+
+    while (free_slots_.empty()) {
+        receive();
+    }
+    const int slot = free_slots_.back();
+    free_slots_.pop_back();
+
+    double* records = reinterpret_cast<double*>(ring_ + slot * slot_bytes_);
+    for (std::size_t kk = 0; kk < x0.size(); kk++) {
+        double* record = records + kk * width;
+        record[0] = x0[kk];
+        if (!params.empty()) {
+            const std::vector<double>& p = params[params.size() == 1 ? 0 : kk];
+            std::copy(p.begin(), p.end(), record + 1);
+        }
+    }
+
+    ServiceRequest request{};
+    request.id = next_id_++;
+    request.slot = static_cast<std::uint32_t>(slot);
+    request.count = static_cast<std::uint32_t>(x0.size());
+    request.width = static_cast<std::uint32_t>(width);
+    request.method = static_cast<std::uint32_t>(method);
+    request.max_iters = options.max_iters;
+    request.source_length = static_cast<std::uint32_t>(source.size());
+    request.tol = options.tol;
+    request.max_evaluations = options.max_evaluations;
+    if (!write_all(socket_, &request, sizeof(request)) || !write_all(socket_, source.data(), source.size())) {
+        free_slots_.push_back(slot);
+        throw std::runtime_error("Solver service closed the connection");
+    }
+    pending_[request.id] = Pending{slot, request.count, request.width};
+    return request.id;
+}
+
+/**
+ * @brief Wait for a submitted request, collecting other responses that
+ * arrive first.
+ *
+ * @param id Identifier returned by submit().
+ * @return One record per problem, in submission order.
+ */
+std::vector<StreamRecord> SolverClient::wait(std::uint64_t id){
+    if (completed_.count(id) == 0 && pending_.count(id) == 0) {
+        throw std::invalid_argument("Unknown or already collected request " + std::to_string(id));
+    }
+    while (completed_.count(id) == 0) {
+        receive();
+    }
+    Completed completed = std::move(completed_[id]);
+    completed_.erase(id);
+    if (!completed.error.empty()) {
+        throw std::runtime_error(completed.error);
+    }
+    return std::move(completed.records);
+}
+
+/**
+ * @brief Submit a batch and wait for its results.
+ *
+ * @param source Expression source, as accepted by CompiledExpression.
+ * @param x0 Initial approximations, one per problem.
+ * @param params No parameter sets, one shared by every problem, or one per
+ * problem.
+ * @param method Solver applied to each problem.
+ * @param options Per-problem iteration, tolerance and evaluation limits.
+ * @return One record per problem, in submission order.
+ */
+std::vector<StreamRecord> SolverClient::solve(
+    const std::string& source,
+    const std::vector<double>& x0,
+    const std::vector<std::vector<double>>& params,
+    StreamMethod method,
+    const SolveOptions& options
+){
+    return wait(submit(source, x0, params, method, options));
+}
+
+/**
+ * @brief Number of submitted requests whose response has not arrived.
+ *
+ * @return Request count.
+ */
+int SolverClient::in_flight() const {
+    return static_cast<int>(pending_.size());
+}
+
+/**
+ * @brief Read one response, copy its results out of the ring and free its
+ * slot.
+ */
+void SolverClient::receive(){
+    ServiceResponse response{};
+    if (!read_all(socket_, &response, sizeof(response))) {
+        throw std::runtime_error("Solver service closed the connection");
+    }
+    Completed completed;
+    completed.error.resize(response.message_length);
+    if (!read_all(socket_, &completed.error[0], completed.error.size())) {
+        throw std::runtime_error("Solver service closed the connection");
+    }
+    const auto found = pending_.find(response.id);
+    if (found == pending_.end()) {
+        throw std::runtime_error("Solver service answered unknown request " + std::to_string(response.id));
+    }
+
+    const Pending& pending = found->second;
+    if (completed.error.empty()) {
+        const unsigned char* slot = ring_ + pending.slot * slot_bytes_;
+        const StreamRecord* results = reinterpret_cast<const StreamRecord*>(slot + static_cast<std::size_t>(pending.count) * pending.width * sizeof(double));
+        completed.records.assign(results, results + pending.count);
+    }
+    free_slots_.push_back(pending.slot);
+    pending_.erase(found);
+    completed_[response.id] = std::move(completed);
+}
@@ -0,0 +1,395 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <tuple>
+#include <unistd.h>
+#include <vector>
+#include "numeric/root_approximation.hpp"
+#include "numeric/streaming.hpp"
+#include "numeric/thread_pool.hpp"
+
+namespace {
+
+/**
+ * @brief Number of blocks each worker thread receives per chunk, so that
+ * records with slow convergence do not leave other threads idle.
+ */
+constexpr int BLOCKS_PER_THREAD = 4;
+
+/**
+ * @brief Build the message for a failed system call on a mapped file.
+ *
+ * @param action What was attempted.
+ * @param path File path.
+ * @return Message including the system error description.
+ */
+std::string system_error_message(const std::string& action, const std::string& path){
+    return "Could not " + action + " " + path + ": " + std::strerror(errno);
+}
+
+/**
+ * @brief Check the stream-wide limits of a solve: the cancellation token and
+ * the deadline.
+ *
+ * @param options Limits of the stream.
+ * @return Status to report for unsolved records, or nothing if the stream may
+ * continue.
+ */
+std::optional<SolveStatus> stream_stopped(const SolveOptions& options){
+    if (options.cancellation && options.cancellation->cancelled()) {
+        return SolveStatus::CANCELLED;
+    }
+    if (options.deadline != std::chrono::steady_clock::time_point::max()
+        && std::chrono::steady_clock::now() >= options.deadline) {
+        return SolveStatus::DEADLINE_EXCEEDED;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Report records as unsolved without running the solver: each keeps
+ * its initial approximation with no iterations.
+ *
+ * @param records count records [x0, p_0, ..., p_{m-1}].
+ * @param parameter_count Number of parameters m per record.
+ * @param count Number of records.
+ * @param results Destination for count output records.
+ * @param status Status reported for every record.
+ */
+void fill_unsolved(
+    const double* records,
+    int parameter_count,
+    long long count,
+    StreamRecord* results,
+    SolveStatus status
+){
+    for (long long ii = 0; ii < count; ii++) {
+        results[ii] = StreamRecord{records[ii * (parameter_count + 1)], static_cast<std::int32_t>(status), 0};
+    }
+}
+
+/**
+ * @brief Solve a single record under the given options.
+ *
+ * @param func Compiled function of x with parameters p.
+ * @param params Parameter vector p of the record.
+ * @param x0 Initial approximation of the record.
+ * @param method Solver to apply.
+ * @param options Limits for the solve.
+ * @return Solve result.
+ */
+SolveResult solve_record(
+    const CompiledExpression& func,
+    const std::vector<double>& params,
+    double x0,
+    StreamMethod method,
+    const SolveOptions& options
+){
+    const std::function<double(double)> f = [&func, &params](double x) { return func.evaluate(x, params); };
+    if (method == StreamMethod::SECANT) {
+        return secant_method(f, x0, x0 + 1e-3 * (1.0 + std::abs(x0)), options);
+    }
+    const std::function<std::tuple<double, double>(double)> f_df = [&func, &params](double x) {
+        return func.evaluate_derivative(x, params);
+    };
+    return newton_method(f_df, x0, options);
+}
+
+}  // namespace
+
+/**
+ * @brief Map an existing file read-only.
+ *
+ * @param path File path.
+ */
+MappedFile::MappedFile(const std::string& path){
+    open(path, 0, false);
+}
+
+/**
+ * @brief Create or truncate a file to size bytes and map it read-write.
+ *
+ * @param path File path.
+ * @param size Length of the file in bytes.
+ */
+MappedFile::MappedFile(const std::string& path, std::size_t size){
+    open(path, size, true);
+}
+
+/**
+ * @brief Unmap and close the file.
+ */
+MappedFile::~MappedFile(){
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+    if (descriptor_ >= 0) {
+        close(descriptor_);
+    }
+}
+
+/**
+ * @brief Open path and map size bytes of it.
+ *
+ * @param path File path.
+ * @param size Length of the file in bytes; ignored for read-only mappings,
+ * which map the whole file.
+ * @param writable Whether to create, truncate and map read-write.
+ */
+void MappedFile::open(const std::string& path, std::size_t size, bool writable){
+    descriptor_ = writable ? ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644) : ::open(path.c_str(), O_RDONLY);
+    if (descriptor_ < 0) {
+        throw std::runtime_error(system_error_message("open", path));
+    }
+
+    if (writable) {
+        if (ftruncate(descriptor_, static_cast<off_t>(size)) != 0) {
+            const std::string message = system_error_message("resize", path);
+            close(descriptor_);
+            throw std::runtime_error(message);
+        }
+    } else {
+        struct stat status{};
+        if (fstat(descriptor_, &status) != 0) {
+            const std::string message = system_error_message("stat", path);
+            close(descriptor_);
+            throw std::runtime_error(message);
+        }
+        size = static_cast<std::size_t>(status.st_size);
+    }
+
+    size_ = size;
+    if (size_ == 0) {
+        return;
+    }
+    void* address = mmap(nullptr, size_, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, descriptor_, 0);
+    if (address == MAP_FAILED) {
+        const std::string message = system_error_message("map", path);
+        close(descriptor_);
+        throw std::runtime_error(message);
+    }
+    data_ = static_cast<unsigned char*>(address);
+    madvise(data_, size_, MADV_SEQUENTIAL);
+}
+
+/**
+ * @brief Start of the mapping.
+ *
+ * @return Pointer to the first byte, or nullptr for an empty file.
+ */
+unsigned char* MappedFile::data() const {
+    return data_;
+}
+
+/**
+ * @brief Length of the mapping.
+ *
+ * @return Size in bytes.
+ */
+std::size_t MappedFile::size() const {
+    return size_;
+}
+
+/**
+ * @brief Page-aligned range covering [offset, offset + length), clipped to
+ * the mapping.
+ *
+ * @param offset First byte of the range.
+ * @param length Length of the range in bytes; updated to the aligned length.
+ * @return Aligned start of the range.
+ */
+unsigned char* MappedFile::aligned(std::size_t offset, std::size_t& length) const {
+    const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const std::size_t end = std::min(offset + length, size_);
+    const std::size_t start = offset - offset % page;
+    length = end > start ? end - start : 0;
+    return data_ + start;
+}
+
+/**
+ * @brief Ask the kernel to start reading a byte range ahead of use.
+ *
+ * @param offset First byte of the range.
+ * @param length Length of the range in bytes.
+ */
+void MappedFile::prefetch(std::size_t offset, std::size_t length) const {
+    unsigned char* start = aligned(offset, length);
+    if (length > 0) {
+        madvise(start, length, MADV_WILLNEED);
+    }
+}
+
+/**
+ * @brief Schedule write-back of a modified byte range without waiting.
+ *
+ * @param offset First byte of the range.
+ * @param length Length of the range in bytes.
+ */
+void MappedFile::flush_async(std::size_t offset, std::size_t length) const {
+    unsigned char* start = aligned(offset, length);
+    if (length > 0) {
+        msync(start, length, MS_ASYNC);
+    }
+}
+
+/**
+ * @brief Drop a byte range from the resident set. Shared mappings keep
+ * modified pages in the page cache, so no data is lost.
+ *
+ * @param offset First byte of the range.
+ * @param length Length of the range in bytes.
+ */
+void MappedFile::release(std::size_t offset, std::size_t length) const {
+    unsigned char* start = aligned(offset, length);
+    if (length > 0) {
+        madvise(start, length, MADV_DONTNEED);
+    }
+}
+
+/**
+ * @brief Write every modified page back to the file and wait for it.
+ */
+void MappedFile::flush() const {
+    if (data_ != nullptr && msync(data_, size_, MS_SYNC) != 0) {
+        throw std::runtime_error(std::string{"Could not write back mapped file: "} + std::strerror(errno));
+    }
+}
+
+/**
+ * @brief Solve f(p, x) = 0 for a contiguous array of records on the calling
+ * thread.
+ *
+ * @param func Compiled function of x with parameters p.
+ * @param records count records [x0, p_0, ..., p_{m-1}].
+ * @param count Number of records.
+ * @param results Destination for count output records.
+ * @param method Solver applied to each record.
+ * @param options Limits applied to each record.
+ * @return Totals over the records; chunks is left at zero.
+ */
+StreamStatistics solve_records(
+    const CompiledExpression& func,
+    const double* records,
+    long long count,
+    StreamRecord* results,
+    StreamMethod method,
+    const SolveOptions& options
+){
+    const int parameter_count = func.parameter_count();
+    std::vector<double> params;
+    params.resize(parameter_count);
+    StreamStatistics statistics;
+    statistics.records = count;
+    for (long long ii = 0; ii < count; ii++) {
+        const double* record = records + ii * (parameter_count + 1);
+        // Once the deadline passes or the token is cancelled, the remaining
+        // records are reported without entering the solver.
+        if (const std::optional<SolveStatus> stopped = stream_stopped(options)) {
+            fill_unsolved(record, parameter_count, count - ii, results + ii, *stopped);
+            break;
+        }
+        std::copy(record + 1, record + 1 + parameter_count, params.begin());
+        const SolveResult result = solve_record(func, params, record[0], method, options);
+        results[ii] = StreamRecord{result.root, static_cast<std::int32_t>(result.status), result.iterations};
+        statistics.converged += result.status == SolveStatus::CONVERGED;
+        statistics.evaluations += result.evaluations;
+    }
+    return statistics;
+}
+
+/**
+ * @brief Solve f(p, x) = 0 for every record of a binary file without loading
+ * it into memory.
+ *
+ * @param func Compiled function of x with parameters p.
+ * @param input_path Path of the parameter file.
+ * @param output_path Path of the result file.
+ * @param method Solver applied to each record.
+ * @param options Limits applied to each record.
+ * @param chunk_records Records per chunk.
+ * @param num_threads Number of worker threads; 0 uses all hardware threads.
+ * @return Totals over the stream.
+ */
+StreamStatistics solve_stream(
+    const CompiledExpression& func,
+    const std::string& input_path,
+    const std::string& output_path,
+    StreamMethod method,
+    const SolveOptions& options,
+    int chunk_records,
+    int num_threads
+){
+    if (chunk_records < 1) {
+        throw std::invalid_argument("Streaming expects a positive number of records per chunk");
+    }
+    const int parameter_count = func.parameter_count();
+    const std::size_t record_bytes = (parameter_count + 1) * sizeof(double);
+
+    const MappedFile input{input_path};
+    if (input.size() % record_bytes != 0) {
+        throw std::invalid_argument(
+            "Input size is not a multiple of the record size of " + std::to_string(record_bytes) + " bytes"
+        );
+    }
+    const long long count = static_cast<long long>(input.size() / record_bytes);
+    const MappedFile output{output_path, static_cast<std::size_t>(count) * sizeof(StreamRecord)};
+
+    StreamStatistics statistics;
+    statistics.records = count;
+    if (count == 0) {
+        return statistics;
+    }
+    const double* records = reinterpret_cast<const double*>(input.data());
+    StreamRecord* results = reinterpret_cast<StreamRecord*>(output.data());
+
+    ThreadPool pool{num_threads};
+    std::atomic<long long> converged{0};
+    std::atomic<long long> evaluations{0};
+
+    input.prefetch(0, std::min<long long>(chunk_records, count) * record_bytes);
+    for (long long begin = 0; begin < count; begin += chunk_records) {
+        const long long end = std::min(begin + chunk_records, count);
+
+        // Read the next chunk ahead while this one is solved.
+        if (end < count) {
+            input.prefetch(end * record_bytes, (std::min(end + chunk_records, count) - end) * record_bytes);
+        }
+
+        const long long length = end - begin;
+        if (const std::optional<SolveStatus> stopped = stream_stopped(options)) {
+            fill_unsolved(records + begin * (parameter_count + 1), parameter_count, length, results + begin, *stopped);
+        } else {
+            const int blocks = static_cast<int>(std::min<long long>(length, BLOCKS_PER_THREAD * pool.size()));
+            parallel_for(pool, 0, blocks, [&](int block) {
+                const long long lo = begin + length * block / blocks;
+                const long long hi = begin + length * (block + 1) / blocks;
+                const StreamStatistics block_statistics = solve_records(
+                    func, records + lo * (parameter_count + 1), hi - lo, results + lo, method, options
+                );
+                converged += block_statistics.converged;
+                evaluations += block_statistics.evaluations;
+            });
+        }
+
+        // Write the finished chunk behind and drop both chunks from memory.
+        output.flush_async(begin * sizeof(StreamRecord), length * sizeof(StreamRecord));
+        output.release(begin * sizeof(StreamRecord), length * sizeof(StreamRecord));
+        input.release(begin * record_bytes, length * record_bytes);
+        statistics.chunks += 1;
+    }
+    output.flush();
+
+    statistics.converged = converged;
+    statistics.evaluations = evaluations;
+    return statistics;
+}
@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "numeric/thread_pool.hpp"
+
+/**
+ * @brief Start the worker threads.
+ *
+ * @param num_threads Number of workers; values <= 0 select the hardware
+ * concurrency.
+ */
+ThreadPool::ThreadPool(int num_threads){
+    if (num_threads <= 0) {
+        num_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    workers_.reserve(num_threads);
+    for (int ii = 0; ii < num_threads; ii++) {
+        workers_.emplace_back([this] { worker_loop(); });
+    }
+}
+
+/**
+ * @brief Finish queued tasks and join the worker threads.
+ */
+ThreadPool::~ThreadPool(){
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopping_ = true;
+    }
+    task_available_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Queue a task for execution by a worker.
+ *
+ * @param task Callable run exactly once.
+ */
+void ThreadPool::submit(std::function<void()> task){
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        tasks_.push_back(std::move(task));
+    }
+    task_available_.notify_one();
+}
+
+/**
+ * @brief Block until every submitted task has finished. Rethrows the first
+ * exception raised by a task, if any.
+ */
+void ThreadPool::wait(){
+    std::unique_lock<std::mutex> lock{mutex_};
+    tasks_finished_.wait(lock, [this] { return tasks_.empty() && active_ == 0; });
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Number of worker threads.
+ *
+ * @return Pool size.
+ */
+int ThreadPool::size() const {
+    return static_cast<int>(workers_.size());
+}
+
+/**
+ * @brief Worker loop: pop and run tasks until the pool is stopped.
+ */
+void ThreadPool::worker_loop(){
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            task_available_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+            active_ += 1;
+        }
+
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!error_) {
+                error_ = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            active_ -= 1;
+            if (tasks_.empty() && active_ == 0) {
+                tasks_finished_.notify_all();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Run body(ii) for ii in [begin, end) on the pool, splitting the range
+ * into contiguous blocks, and wait for completion.
+ *
+ * @param pool Pool executing the blocks.
+ * @param begin First index.
+ * @param end One past the last index.
+ * @param body Callable invoked once per index; must be thread-safe.
+ */
+void parallel_for(ThreadPool& pool, int begin, int end, const std::function<void(int)>& body){
+    const int count = end - begin;
+    if (count <= 0) {
+        return;
+    }
+    const int blocks = std::min(count, 4 * pool.size());
+    for (int block = 0; block < blocks; block++) {
+        const int first = begin + static_cast<int>(static_cast<long long>(count) * block / blocks);
+        const int last = begin + static_cast<int>(static_cast<long long>(count) * (block + 1) / blocks);
+        pool.submit([first, last, &body] {
+            for (int ii = first; ii < last; ii++) {
+                body(ii);
+            }
+        });
+    }
+    pool.wait();
+}
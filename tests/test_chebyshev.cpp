@@ -0,0 +1,65 @@
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/chebyshev.hpp"
+
+TEST_CASE("chebyshev coefficients recover chebyshev polynomial", "[chebyshev_coefficients]") {
+    for (int n : {8, 10}) {
+        std::vector<double> values;
+        for (double x : chebyshev_points(n, -1.0, 1.0)) {
+            values.push_back(2.0 + 3.0 * x + (4.0 * x * x * x - 3.0 * x));
+        }
+        const std::vector<double> coefs = chebyshev_coefficients(values);
+
+        REQUIRE(coefs.size() == static_cast<std::size_t>(n + 1));
+        for (int kk = 0; kk <= n; kk++) {
+            const double reference = kk == 0 ? 2.0 : kk == 1 ? 3.0 : kk == 3 ? 1.0 : 0.0;
+            REQUIRE(std::abs(coefs[kk] - reference) < 1e-13);
+        }
+    }
+}
+
+TEST_CASE("clenshaw evaluates series and derivative", "[clenshaw]") {
+    // T_0 + 2 T_1 - T_2 + 0.5 T_3 = 2 + 2x - 2x^2 + 2x^3 - 1.5x
+    const double coefs[] = {1.0, 2.0, -1.0, 0.5};
+    const auto [value, derivative] = clenshaw(3, coefs, 0.3);
+    const double reference = 2.0 + 0.5 * 0.3 - 2.0 * 0.09 + 2.0 * 0.027;
+    const double reference_derivative = 0.5 - 4.0 * 0.3 + 6.0 * 0.09;
+
+    REQUIRE(std::abs(value - reference) < 1e-14);
+    REQUIRE(std::abs(derivative - reference_derivative) < 1e-14);
+}
+
+TEST_CASE("chebyshev fit resolves smooth function adaptively", "[chebyshev_fit]") {
+    const std::function<double(double)> function = [](double x) { return std::exp(x) * std::sin(3.0 * x); };
+    const ChebyshevSeries series = chebyshev_fit(function, 0.0, 2.0, 256, 1e-14);
+
+    REQUIRE(series.resolved);
+    REQUIRE(series.coefs.size() < 40);
+    for (double x : {0.0, 0.37, 1.5, 2.0}) {
+        const auto [value, derivative] = series.evaluate(x);
+        REQUIRE(std::abs(value - function(x)) < 1e-13);
+        REQUIRE(std::abs(derivative - std::exp(x) * (std::sin(3.0 * x) + 3.0 * std::cos(3.0 * x))) < 1e-10);
+    }
+}
+
+TEST_CASE("chebyshev fit reports unresolved function", "[chebyshev_fit]") {
+    const std::function<double(double)> function = [](double x) { return std::abs(x - 0.1); };
+    const ChebyshevSeries series = chebyshev_fit(function, -1.0, 1.0, 64, 1e-14);
+
+    REQUIRE_FALSE(series.resolved);
+}
+
+TEST_CASE("chebyshev series roots finds roots of interpolant", "[chebyshev_series_roots]") {
+    const std::function<double(double)> function = [](double x) { return (x - 0.25) * (x + 0.5) * (x - 0.9); };
+    const ChebyshevSeries series = chebyshev_fit(function, -1.0, 1.0, 64, 1e-15);
+    const std::vector<double> roots = chebyshev_series_roots(series);
+
+    REQUIRE(roots.size() == 3);
+    REQUIRE(std::abs(roots[0] + 0.5) < 1e-13);
+    REQUIRE(std::abs(roots[1] - 0.25) < 1e-13);
+    REQUIRE(std::abs(roots[2] - 0.9) < 1e-13);
+}
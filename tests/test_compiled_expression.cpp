@@ -0,0 +1,139 @@
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/compiled_expression.hpp"
+#include "numeric/root_approximation.hpp"
+
+TEST_CASE("compiled expression evaluates with Python precedence", "[compiled_expression]") {
+    const CompiledExpression f{"x**3 + 4*x**2 - 10"};
+    REQUIRE(std::abs(f(1.5) - 2.375) < 1e-14);
+
+    const CompiledExpression g{"-x^2 + 2**3**0 / (1 + 1) * sin(pi / 2)"};
+    REQUIRE(std::abs(g(3.0) - (-9.0 + 1.0)) < 1e-14);
+    REQUIRE(g.instructions().size() == 5);
+
+    const CompiledExpression h{"exp(-p0 * x) * cos(p1*x) + sqrt(x) - log(x) + tan(x) + x**0.5"};
+    const std::vector<double> p = {0.3, 2.0};
+    const double x = 0.7;
+    const double reference = std::exp(-0.3 * x) * std::cos(2.0 * x) + 2 * std::sqrt(x) - std::log(x) + std::tan(x);
+    REQUIRE(std::abs(h.evaluate(x, p) - reference) < 1e-14);
+    REQUIRE(h.parameter_count() == 2);
+}
+
+TEST_CASE("compiled expression derivative tape matches finite differences", "[compiled_expression]") {
+    const CompiledExpression f{"x**x + exp(p0 * x) * sin(x) / (1 + x**-2) - tan(x)**3"};
+    const std::vector<double> p = {-0.5};
+
+    for (double x : {0.4, 1.1, 2.5}) {
+        const auto [value, derivative] = f.evaluate_derivative(x, p);
+        const double h = 1e-6;
+        const double reference = (f.evaluate(x + h, p) - f.evaluate(x - h, p)) / (2 * h);
+        REQUIRE(std::abs(value - f.evaluate(x, p)) < 1e-14);
+        REQUIRE(std::abs(derivative - reference) < 1e-6 * (1 + std::abs(reference)));
+    }
+}
+
+TEST_CASE("compiled expression lane evaluation matches scalar evaluation", "[compiled_expression]") {
+    const CompiledExpression f{"x**x + exp(p0 * x) * sin(x) / (1 + x**-2) - tan(x)**3 + sqrt(x) * log(x) - cos(p1 - x)"};
+    const int n = 3 * CompiledExpression::LANE_BLOCK + 5;
+    std::vector<std::vector<double>> params;
+    std::vector<const double*> lane_params;
+    std::vector<double> x;
+    for (int ii = 0; ii < n; ii++) {
+        params.push_back({-0.5 + 0.01 * ii, 0.1 * ii});
+        x.push_back(0.3 + 0.02 * ii);
+    }
+    for (const std::vector<double>& set : params) {
+        lane_params.push_back(set.data());
+    }
+
+    std::vector<double> values(n), lane_f(n), lane_df(n);
+    f.evaluate_lanes(x.data(), lane_params.data(), values.data(), n);
+    f.evaluate_derivative_lanes(x.data(), lane_params.data(), lane_f.data(), lane_df.data(), n);
+    for (int ii = 0; ii < n; ii++) {
+        const auto [value, derivative] = f.evaluate_derivative(x[ii], params[ii]);
+        REQUIRE(std::abs(values[ii] - f.evaluate(x[ii], params[ii])) < 1e-13 * (1 + std::abs(value)));
+        REQUIRE(std::abs(lane_f[ii] - value) < 1e-13 * (1 + std::abs(value)));
+        REQUIRE(std::abs(lane_df[ii] - derivative) < 1e-13 * (1 + std::abs(derivative)));
+    }
+}
+
+TEST_CASE("compiled expression drives newton and batch solves", "[compiled_expression]") {
+    const CompiledExpression f{"x**2 - p0"};
+    const std::vector<double> p = {2.0};
+    const auto func = [&f, &p](double x) { return f.evaluate(x, p); };
+    const auto dfunc = [&f, &p](double x) { return std::get<1>(f.evaluate_derivative(x, p)); };
+    REQUIRE(std::abs(newton_method(func, dfunc, 1.0, 100, 1e-12) - std::sqrt(2.0)) < 1e-12);
+
+    const std::vector<double> x0 = {1.0, 1.0, 1.0, 1.0};
+    const std::vector<std::vector<double>> params = {{1.0}, {2.0}, {3.0}, {4.0}};
+    const std::vector<double> roots = newton_method_batch(f, x0, params, 100, 1e-12, 2);
+    for (int kk = 0; kk < 4; kk++) {
+        REQUIRE(std::abs(roots[kk] - std::sqrt(kk + 1.0)) < 1e-12);
+    }
+
+    const CompiledExpression cubic{"x**3 + 4*x**2 - 10"};
+    REQUIRE(std::abs(newton_method(cubic, 1.5, 100, 1e-12) - 1.36523001341410) < 1e-12);
+}
+
+TEST_CASE("compiled expression batch solves take solve options", "[compiled_expression]") {
+    const CompiledExpression f{"x**2 - p0"};
+    const std::vector<double> x0 = {1.0, 1.0, 1.0};
+    const std::vector<std::vector<double>> params = {{1.0}, {4.0}, {9.0}};
+    SolveOptions options;
+    options.tol = 1e-12;
+
+    const std::vector<SolveResult> results = newton_method_batch(f, x0, params, options, 2);
+    REQUIRE(results.size() == 3);
+    for (int kk = 0; kk < 3; kk++) {
+        REQUIRE(results[kk].status == SolveStatus::CONVERGED);
+        REQUIRE(std::abs(results[kk].root - (kk + 1.0)) < 1e-12);
+        REQUIRE(results[kk].evaluations == results[kk].iterations);
+    }
+
+    const CancellationToken token;
+    token.cancel();
+    options.cancellation = token;
+    for (const SolveResult& result : newton_method_batch(f, x0, params, options, 2)) {
+        REQUIRE(result.status == SolveStatus::CANCELLED);
+    }
+}
+
+TEST_CASE("compiled expression reports errors", "[compiled_expression]") {
+    REQUIRE_THROWS_AS(CompiledExpression("x +"), std::invalid_argument);
+    REQUIRE_THROWS_AS(CompiledExpression("(x"), std::invalid_argument);
+    REQUIRE_THROWS_AS(CompiledExpression("foo(x)"), std::invalid_argument);
+    REQUIRE_THROWS_AS(CompiledExpression("x y"), std::invalid_argument);
+    REQUIRE_THROWS_AS(CompiledExpression("x + p99999999999"), std::invalid_argument);
+    REQUIRE_THROWS_AS(CompiledExpression("x + p1024"), std::invalid_argument);
+    REQUIRE(CompiledExpression("x + p1023").parameter_count() == 1024);
+
+    const CompiledExpression f{"x - p1"};
+    REQUIRE_THROWS_AS(f.evaluate(1.0, {0.0}), std::invalid_argument);
+    REQUIRE_THROWS_AS(newton_method_batch(f, {1.0, 2.0}, {{0.0, 1.0}, {0.0, 1.0}, {0.0, 1.0}}, 10, 1e-8, 1), std::invalid_argument);
+}
+
+TEST_CASE("compiled expression bounds nesting and handles long chains", "[compiled_expression]") {
+    const int depth = CompiledExpression::MAX_DEPTH;
+    const std::string nested = std::string(100000, '(') + "x" + std::string(100000, ')');
+    REQUIRE_THROWS_AS(CompiledExpression(nested), std::invalid_argument);
+    REQUIRE_THROWS_AS(CompiledExpression(std::string(1000000, '-') + "x"), std::invalid_argument);
+    REQUIRE_THROWS_AS(CompiledExpression("x**" + std::string(depth, '-') + "2"), std::invalid_argument);
+    const std::string shallow = std::string(depth - 2, '(') + "x" + std::string(depth - 2, ')');
+    REQUIRE(CompiledExpression(shallow)(3.0) == 3.0);
+
+    // Left-deep chains are parsed in a loop; compiling and releasing them
+    // must not recurse once per term.
+    std::string chain = "x";
+    for (int kk = 1; kk < 300000; kk++) {
+        chain += "+x";
+    }
+    const CompiledExpression sum{chain};
+    REQUIRE(sum(1.0) == 300000.0);
+    REQUIRE(sum.register_count() == 2);
+}
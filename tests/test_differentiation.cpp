@@ -0,0 +1,69 @@
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/differentiation.hpp"
+
+TEST_CASE("optimal step scales with magnitude of x", "[optimal_step]") {
+    REQUIRE(std::abs(optimal_step(0.5, 2) - std::cbrt(2.220446049250313e-16)) < 1e-12);
+    REQUIRE(std::abs(optimal_step(1e4, 2) - 1e4 * optimal_step(0.0, 2)) < 1e-12);
+}
+
+TEST_CASE("complex step derivative is accurate to machine precision", "[complex_step_derivative]") {
+    const std::function<std::complex<double>(std::complex<double>)> function =
+        [](std::complex<double> x) {
+            return std::exp(x) / std::sqrt(std::pow(std::sin(x), 3) + std::pow(std::cos(x), 3));
+        };
+    const double approx = complex_step_derivative(function, 1.5, 1e-20);
+    const double reference = 4.05342789389862;
+
+    REQUIRE(std::abs(approx - reference) < 1e-13);
+}
+
+TEST_CASE("centered difference stencils reach their order of accuracy", "[centered_difference]") {
+    const std::function<double(double)> function = [](double x) { return std::sin(x); };
+    const double reference = std::cos(1.0);
+    const double h = 1e-2;
+
+    const double error_2 = std::abs(centered_difference(function, 1.0, h, 2) - reference);
+    const double error_4 = std::abs(centered_difference(function, 1.0, h, 4) - reference);
+    const double error_6 = std::abs(centered_difference(function, 1.0, h, 6) - reference);
+
+    REQUIRE(error_2 < 1e-5);
+    REQUIRE(error_4 < 1e-9);
+    REQUIRE(error_6 < 1e-12);
+}
+
+TEST_CASE("centered difference throws for unsupported order", "[centered_difference]") {
+    const std::function<double(double)> function = [](double x) { return x * x; };
+    REQUIRE_THROWS_AS(centered_difference(function, 1.0, 1e-3, 3), std::invalid_argument);
+}
+
+TEST_CASE("richardson derivative improves on centered difference", "[richardson_derivative]") {
+    const std::function<double(double)> function = [](double x) { return x * std::exp(x); };
+    const double approx = richardson_derivative(function, 2.0, 0.2, 10, 1e-13);
+    const double reference = 3.0 * std::exp(2.0);
+
+    REQUIRE(std::abs(approx - reference) < 1e-10);
+}
+
+TEST_CASE("batched derivatives evaluate every point", "[centered_difference_batch]") {
+    const std::function<double(double)> function = [](double x) { return std::exp(x); };
+    const std::function<std::complex<double>(std::complex<double>)> complex_function =
+        [](std::complex<double> x) { return std::exp(x); };
+    const std::vector<double> x = {-1.0, 0.0, 0.5, 3.0};
+
+    const std::vector<double> approx = centered_difference_batch(function, x, 4);
+    const std::vector<double> complex_approx = complex_step_derivative_batch(complex_function, x, 1e-20);
+
+    REQUIRE(approx.size() == x.size());
+    REQUIRE(complex_approx.size() == x.size());
+    for (std::size_t ii = 0; ii < x.size(); ii++) {
+        REQUIRE(std::abs(approx[ii] - std::exp(x[ii])) < 1e-10 * std::exp(x[ii]));
+        REQUIRE(std::abs(complex_approx[ii] - std::exp(x[ii])) < 1e-14 * std::exp(x[ii]));
+    }
+}
@@ -0,0 +1,70 @@
+import cmath
+import math
+
+import numeric
+import pytest
+
+
+@pytest.mark.parametrize(
+    "function_name",
+    [
+        "optimal_step",
+        "complex_step_derivative",
+        "centered_difference",
+        "richardson_derivative",
+        "centered_difference_batch",
+        "complex_step_derivative_batch",
+    ],
+)
+def test_binding_docstrings_include_numpy_sections(function_name):
+    doc = getattr(numeric.differentiation, function_name).__doc__
+    assert doc is not None
+    assert "Parameters" in doc
+    assert "Returns" in doc
+
+
+@pytest.mark.smoke
+def test_complex_step_derivative_01():
+    def function(x):
+        return cmath.exp(x) / cmath.sqrt(cmath.sin(x) ** 3 + cmath.cos(x) ** 3)
+
+    approx = numeric.differentiation.complex_step_derivative(function, 1.5)
+    reference = 4.05342789389862
+    assert abs(approx - reference) < 1e-13
+
+
+@pytest.mark.smoke
+def test_centered_difference_01():
+    approx = numeric.differentiation.centered_difference(math.sin, 1.0, 1e-2)
+    reference = math.cos(1.0)
+    assert abs(approx - reference) < 1e-9
+
+
+def test_centered_difference_02_error_order():
+    with pytest.raises(ValueError, match="orders 2, 4 and 6"):
+        numeric.differentiation.centered_difference(math.sin, 1.0, 1e-2, 3)
+
+
+@pytest.mark.smoke
+def test_richardson_derivative_01():
+    def function(x):
+        return x * math.exp(x)
+
+    approx = numeric.differentiation.richardson_derivative(function, 2.0)
+    reference = 3 * math.exp(2.0)
+    assert abs(approx - reference) < 1e-9
+
+
+def test_centered_difference_batch_01():
+    x = [-1.0, 0.0, 0.5, 3.0]
+    approx = numeric.differentiation.centered_difference_batch(math.exp, x)
+    for a, p in zip(approx, x):
+        assert abs(a - math.exp(p)) < 1e-10 * math.exp(p)
+
+
+def test_complex_step_derivative_batch_01():
+    x = [-1.0, 0.0, 0.5, 3.0]
+    differentiation = numeric.differentiation
+    approx = differentiation.complex_step_derivative_batch(cmath.exp, x)
+    for a, p in zip(approx, x):
+        assert abs(a - math.exp(p)) < 1e-14 * math.exp(p)
@@ -0,0 +1,54 @@
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/expression.hpp"
+#include "numeric/interval.hpp"
+#include "numeric/root_approximation.hpp"
+#include "numeric/taylor.hpp"
+
+TEST_CASE("expression evaluates and differentiates polynomials", "[expression]") {
+    const expression::Variable x;
+    const auto f = pow(x, 3) + 4.0 * pow(x, 2) - 10;
+
+    REQUIRE(std::abs(f(1.5) - 2.375) < 1e-14);
+    REQUIRE(std::abs(f.derivative()(1.5) - 18.75) < 1e-14);
+    REQUIRE(std::abs(derivative(derivative(f))(1.5) - 17.0) < 1e-14);
+}
+
+TEST_CASE("expression derivatives agree with Taylor mode", "[expression]") {
+    const expression::Variable x;
+    const auto f = sin(x) * exp(x) / sqrt(x) - log(x) + cos(-x);
+
+    const Taylor<2> reference = f(Taylor<2>::variable(1.5));
+    REQUIRE(std::abs(f(1.5) - reference.value()) < 1e-14);
+    REQUIRE(std::abs(f.derivative()(1.5) - reference.derivative(1)) < 1e-13);
+    REQUIRE(std::abs(f.derivative().derivative()(1.5) - reference.derivative(2)) < 1e-12);
+}
+
+TEST_CASE("expression evaluates on intervals", "[expression]") {
+    const expression::Variable x;
+    const auto f = pow(x, 3) + 4.0 * pow(x, 2) - 10.0;
+
+    const Interval range = f(Interval{1.0, 2.0});
+    REQUIRE(range.contains(-5.0));
+    REQUIRE(range.contains(14.0));
+
+    const std::vector<RootEnclosure> roots = interval_newton(f, f.derivative(), 1.0, 2.0, 100, 1e-12, 1);
+    REQUIRE(roots.size() == 1);
+    REQUIRE(roots[0].enclosure.contains(1.36523001341410));
+}
+
+TEST_CASE("newton and halley accept expressions", "[expression]") {
+    const expression::Variable x;
+    const auto f = pow(x, 3) + 4.0 * pow(x, 2) - 10.0;
+
+    REQUIRE(std::abs(newton_method(f, 1.5, 100, 1e-12) - 1.36523001341410) < 1e-12);
+    REQUIRE(std::abs(halley_method(f, 1.5, 100, 1e-12) - 1.36523001341410) < 1e-12);
+
+    // Lambdas still resolve to the std::function overload.
+    const double root = newton_method([](double y) { return y * y - 2.0; }, 1.0, 100, 1e-12);
+    REQUIRE(std::abs(root - std::sqrt(2.0)) < 1e-10);
+}
@@ -0,0 +1,60 @@
+#include <cmath>
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/interval.hpp"
+
+TEST_CASE("interval arithmetic encloses exact results", "[interval]") {
+    const Interval a{1.0, 2.0};
+    const Interval b{-3.0, 0.5};
+
+    const Interval sum = a + b;
+    const Interval product = a * b;
+    const Interval quotient = b / a;
+
+    REQUIRE(sum.lower <= -2.0);
+    REQUIRE(sum.upper >= 2.5);
+    REQUIRE(product.lower <= -6.0);
+    REQUIRE(product.upper >= 1.0);
+    REQUIRE(quotient.lower <= -3.0);
+    REQUIRE(quotient.upper >= 0.5);
+    REQUIRE(product.width() < 7.0 + 1e-12);
+}
+
+TEST_CASE("interval rounding is outward for inexact operations", "[interval]") {
+    const Interval tenth = Interval(1.0) / Interval(10.0);
+
+    REQUIRE(tenth.lower < tenth.upper);
+    REQUIRE(tenth.contains(0.1));
+
+    const Interval third = Interval(1.0) / Interval(3.0);
+    const Interval one = third * 3.0;
+    REQUIRE(one.contains(1.0));
+}
+
+TEST_CASE("interval even power of interval containing zero", "[interval]") {
+    const Interval x{-2.0, 1.0};
+    const Interval square = pow(x, 2);
+
+    REQUIRE(square.lower == 0.0);
+    REQUIRE(square.upper >= 4.0);
+    REQUIRE(square.upper < 4.0 + 1e-12);
+}
+
+TEST_CASE("interval sine and cosine include interior extrema", "[interval]") {
+    const Interval s = sin(Interval(1.0, 2.0));
+    const Interval c = cos(Interval(3.0, 3.5));
+
+    REQUIRE(s.upper == 1.0);
+    REQUIRE(s.lower <= std::sin(1.0));
+    REQUIRE(c.lower == -1.0);
+    REQUIRE(c.upper >= std::cos(3.5));
+}
+
+TEST_CASE("interval operations reject invalid domains", "[interval]") {
+    REQUIRE_THROWS_AS(Interval(2.0, 1.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(Interval(1.0) / Interval(-1.0, 1.0), std::domain_error);
+    REQUIRE_THROWS_AS(log(Interval(0.0, 1.0)), std::domain_error);
+    REQUIRE_THROWS_AS(sqrt(Interval(-1.0, 1.0)), std::domain_error);
+}
@@ -0,0 +1,72 @@
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/inverse_table.hpp"
+
+TEST_CASE("inverse table inverts increasing function", "[inverse_table]") {
+    const std::function<double(double)> function = [](double x) {
+        return x * x * x + 4.0 * x * x - 10.0;
+    };
+    const InverseTable table{function, 0.0, 3.0, 8, 1e-12, 2};
+
+    REQUIRE(std::abs(table.lower() + 10.0) < 1e-12);
+    REQUIRE(std::abs(table.upper() - 53.0) < 1e-12);
+    REQUIRE(std::abs(table.evaluate(0.0, false) - 1.36523001341410) < 1e-10);
+    for (double x : {0.1, 0.7, 1.9, 2.95}) {
+        REQUIRE(std::abs(table.evaluate(function(x), false) - x) < 1e-10);
+    }
+}
+
+TEST_CASE("inverse table inverts decreasing function", "[inverse_table]") {
+    const std::function<double(double)> function = [](double x) { return std::exp(-x); };
+    const InverseTable table{function, 0.0, 5.0, 10, 1e-13, 0};
+
+    const std::vector<double> y = {1.0, 0.5, 0.1, std::exp(-5.0)};
+    const std::vector<double> x = table.evaluate(y, false);
+    for (std::size_t ii = 0; ii < y.size(); ii++) {
+        REQUIRE(std::abs(x[ii] + std::log(y[ii])) < 1e-11);
+    }
+}
+
+TEST_CASE("inverse table splits pieces of odd degree", "[inverse_table]") {
+    // Odd degree has no Chebyshev point at the middle of a piece, so the
+    // split solves for it separately.
+    const std::function<double(double)> function = [](double x) { return 1.0 / (1.0 + x); };
+    const InverseTable table{function, 0.0, 20.0, 7, 1e-12, 2};
+
+    for (double x : {0.0, 0.3, 2.5, 11.0, 19.9, 20.0}) {
+        REQUIRE(std::abs(table.evaluate(function(x), false) - x) < 1e-9);
+    }
+}
+
+TEST_CASE("inverse table newton polish improves a coarse table", "[inverse_table]") {
+    std::atomic<int> evaluations{0};
+    const std::function<double(double)> function = [&evaluations](double x) {
+        evaluations += 1;
+        return x + 0.5 * std::sin(x);
+    };
+    const InverseTable table{function, 0.0, 10.0, 4, 1e-5, 3};
+
+    const double y = function(4.321);
+    const int before = evaluations;
+    const double coarse = std::abs(table.evaluate(y, false) - 4.321);
+    const double polished = std::abs(table.evaluate(y, true) - 4.321);
+
+    REQUIRE(evaluations - before == 1);
+    REQUIRE(polished < 1e-9);
+    REQUIRE(polished < coarse);
+}
+
+TEST_CASE("inverse table rejects invalid input", "[inverse_table]") {
+    const std::function<double(double)> constant = [](double) { return 1.0; };
+    const std::function<double(double)> identity = [](double x) { return x; };
+
+    REQUIRE_THROWS_AS(InverseTable(constant, 0.0, 1.0, 8, 1e-12, 1), std::invalid_argument);
+    const InverseTable table{identity, 0.0, 1.0, 8, 1e-12, 1};
+    REQUIRE_THROWS_AS(table.evaluate(2.0, false), std::out_of_range);
+}
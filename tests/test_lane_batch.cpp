@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/lane_batch.hpp"
+#include "numeric/root_approximation.hpp"
+
+TEST_CASE("newton_method_lanes matches scalar Newton and keeps lanes full", "[lane_batch]") {
+    // Problems x^3 - c_k = 0 from x0 = 1 take from a few to many iterations.
+    std::vector<double> c, x0;
+    for (int kk = 0; kk < 500; kk++) {
+        c.push_back(1.0 + 10.0 * kk);
+        x0.push_back(1.0);
+    }
+    int max_batch = 0;
+    const LaneFunctionDerivative func = [&](const int* problems, const double* x, double* f, double* df, int n) {
+        max_batch = std::max(max_batch, n);
+        for (int ii = 0; ii < n; ii++) {
+            f[ii] = x[ii] * x[ii] * x[ii] - c[problems[ii]];
+            df[ii] = 3.0 * x[ii] * x[ii];
+        }
+    };
+
+    const LaneBatchResult result = newton_method_lanes(func, x0, 16, 100, 1e-12);
+    REQUIRE(max_batch == 16);
+    REQUIRE(result.utilization > 0.9);
+    for (int kk = 0; kk < 500; kk++) {
+        const std::function<double(double)> f = [&](double x) { return x * x * x - c[kk]; };
+        const std::function<double(double)> df = [](double x) { return 3.0 * x * x; };
+        REQUIRE(result.status[kk] == SolveStatus::CONVERGED);
+        REQUIRE(result.roots[kk] == newton_method(f, df, 1.0, 100, 1e-12));
+        REQUIRE(std::abs(result.roots[kk] - std::cbrt(c[kk])) < 1e-10);
+    }
+}
+
+TEST_CASE("lanes retire divergent problems without holding back the others", "[lane_batch]") {
+    // x^2 + 1 has no real root, so problem 0 runs to MAX_ITERS.
+    const std::vector<double> shift{-1.0, 4.0, 9.0, 16.0};
+    const LaneFunctionDerivative func = [&](const int* problems, const double* x, double* f, double* df, int n) {
+        for (int ii = 0; ii < n; ii++) {
+            f[ii] = x[ii] * x[ii] - shift[problems[ii]];
+            df[ii] = 2.0 * x[ii];
+        }
+    };
+    const LaneBatchResult result = newton_method_lanes(func, {0.5, 1.0, 1.0, 1.0}, 2, 40, 1e-12);
+    REQUIRE(result.status[0] == SolveStatus::MAX_ITERATIONS);
+    REQUIRE(result.iterations[0] == 40);
+    for (int kk = 1; kk < 4; kk++) {
+        REQUIRE(result.status[kk] == SolveStatus::CONVERGED);
+        REQUIRE(std::abs(result.roots[kk] - std::sqrt(shift[kk])) < 1e-12);
+    }
+    REQUIRE(result.lane_evaluations == 40 + result.iterations[1] + result.iterations[2] + result.iterations[3]);
+}
+
+TEST_CASE("secant_method_lanes matches scalar secant", "[lane_batch]") {
+    std::vector<double> x0, x1;
+    for (int kk = 0; kk < 100; kk++) {
+        x0.push_back(0.1 * kk);
+        x1.push_back(0.1 * kk + 0.5);
+    }
+    const LaneFunction func = [](const int*, const double* x, double* f, int n) {
+        for (int ii = 0; ii < n; ii++) {
+            f[ii] = std::cos(x[ii]) - x[ii];
+        }
+    };
+    const LaneBatchResult result = secant_method_lanes(func, x0, x1, 8, 100, 1e-12);
+    const std::function<double(double)> f = [](double x) { return std::cos(x) - x; };
+    for (int kk = 0; kk < 100; kk++) {
+        REQUIRE(result.status[kk] == SolveStatus::CONVERGED);
+        REQUIRE(result.roots[kk] == secant_method(f, x0[kk], x1[kk], 100, 1e-12));
+    }
+    REQUIRE_THROWS_AS(secant_method_lanes(func, x0, {1.0}, 8, 100, 1e-12), std::invalid_argument);
+}
+
+TEST_CASE("lane batches accept compiled and template expressions", "[lane_batch]") {
+    const CompiledExpression compiled{"x^2 - p0"};
+    const LaneBatchResult newton = newton_method_lanes(compiled, {1.0, 1.0, 1.0}, {{2.0}, {3.0}, {5.0}}, 2, 100, 1e-12);
+    REQUIRE(std::abs(newton.roots[2] - std::sqrt(5.0)) < 1e-12);
+    const LaneBatchResult secant = secant_method_lanes(compiled, {1.0, 1.0}, {2.0, 2.0}, {{7.0}}, 4, 100, 1e-12);
+    REQUIRE(std::abs(secant.roots[1] - std::sqrt(7.0)) < 1e-12);
+
+    const expression::Variable x;
+    const auto f = pow(x, 3) + 4.0 * pow(x, 2) - 10.0;
+    const LaneBatchResult result = newton_method_lanes(f, {1.0, 1.5, 2.0}, 4, 100, 1e-12);
+    for (double root : result.roots) {
+        REQUIRE(std::abs(root - 1.36523001341410) < 1e-10);
+    }
+    REQUIRE_THROWS_AS(newton_method_lanes(f, {1.0}, 0, 100, 1e-12), std::invalid_argument);
+    REQUIRE_THROWS_AS(newton_method_lanes(compiled, {1.0}, {}, 4, 100, 1e-12), std::invalid_argument);
+    REQUIRE_THROWS_AS(secant_method_lanes(compiled, {1.0, 1.0}, {2.0, 2.0}, {{7.0}, {}}, 4, 100, 1e-12), std::invalid_argument);
+}
@@ -0,0 +1,100 @@
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/nonlinear_systems.hpp"
+
+namespace {
+
+std::vector<double> example_system(const std::vector<double>& x) {
+    return {
+        3.0 * x[0] - std::cos(x[1] * x[2]) - 0.5,
+        x[0] * x[0] - 81.0 * (x[1] + 0.1) * (x[1] + 0.1) + std::sin(x[2]) + 1.06,
+        std::exp(-x[0] * x[1]) + 20.0 * x[2] + (10.0 * M_PI - 3.0) / 3.0,
+    };
+}
+
+}  // namespace
+
+TEST_CASE("finite difference jacobian approximates linear map", "[finite_difference_jacobian]") {
+    const std::function<std::vector<double>(const std::vector<double>&)> function =
+        [](const std::vector<double>& x) {
+            return std::vector<double>{2.0 * x[0] + x[1], -x[0] + 3.0 * x[1]};
+        };
+    const std::vector<double> jacobian = finite_difference_jacobian(function, {1.0, 2.0}, 1e-3);
+    const std::vector<double> reference = {2.0, 1.0, -1.0, 3.0};
+
+    REQUIRE(jacobian.size() == reference.size());
+    for (std::size_t ii = 0; ii < reference.size(); ii++) {
+        REQUIRE(std::abs(jacobian[ii] - reference[ii]) < 1e-10);
+    }
+}
+
+TEST_CASE("broyden method solves nonlinear system", "[broyden_method]") {
+    const std::function<std::vector<double>(const std::vector<double>&)> function = example_system;
+    const std::vector<double> approx = broyden_method(function, {0.1, 0.1, -0.1}, 100, 1e-10);
+    const std::vector<double> reference = {0.5, 0.0, -0.52359877559829887};
+
+    for (std::size_t ii = 0; ii < reference.size(); ii++) {
+        REQUIRE(std::abs(approx[ii] - reference[ii]) < 1e-8);
+    }
+}
+
+TEST_CASE("broyden method uses one evaluation per iteration", "[broyden_method]") {
+    int evaluations = 0;
+    const std::function<std::vector<double>(const std::vector<double>&)> function =
+        [&evaluations](const std::vector<double>& x) {
+            evaluations += 1;
+            return example_system(x);
+        };
+    const int MAX_ITERS = 100;
+    broyden_method(function, {0.1, 0.1, -0.1}, MAX_ITERS, 1e-10);
+
+    // 2n evaluations for the initial Jacobian, then one per iteration.
+    REQUIRE(evaluations <= 2 * 3 + MAX_ITERS);
+    REQUIRE(evaluations < 2 * 3 + 20);
+}
+
+TEST_CASE("broyden method reuses workspace across solves", "[broyden_method]") {
+    const std::function<std::vector<double>(const std::vector<double>&)> function =
+        [](const std::vector<double>& x) {
+            return std::vector<double>{x[0] * x[0] - 2.0, x[0] * x[1] - 1.0};
+        };
+    BroydenWorkspace workspace(2);
+    const std::vector<double> first = broyden_method(function, {1.0, 1.0}, 100, 1e-10, workspace);
+    const std::vector<double> second = broyden_method(function, {1.5, 0.5}, 100, 1e-10, workspace);
+
+    REQUIRE(std::abs(first[0] - std::sqrt(2.0)) < 1e-8);
+    REQUIRE(std::abs(first[1] - 1.0 / std::sqrt(2.0)) < 1e-8);
+    REQUIRE(std::abs(second[0] - std::sqrt(2.0)) < 1e-8);
+    REQUIRE(std::abs(second[1] - 1.0 / std::sqrt(2.0)) < 1e-8);
+}
+
+TEST_CASE("broyden method throws for singular jacobian", "[broyden_method]") {
+    const std::function<std::vector<double>(const std::vector<double>&)> function =
+        [](const std::vector<double>& x) {
+            return std::vector<double>{x[0] + x[1], 2.0 * x[0] + 2.0 * x[1]};
+        };
+
+    REQUIRE_THROWS_AS(broyden_method(function, {1.0, 1.0}, 100, 1e-8), std::runtime_error);
+}
+
+TEST_CASE("broyden method batch solves independent systems", "[broyden_method_batch]") {
+    const std::function<std::vector<double>(int, const std::vector<double>&)> function =
+        [](int k, const std::vector<double>& x) {
+            const double c = static_cast<double>(k + 2);
+            return std::vector<double>{x[0] * x[0] - c, x[0] + x[1] - 1.0};
+        };
+    const std::vector<std::vector<double>> initial = {{1.0, 0.0}, {2.0, 0.0}, {2.0, 0.0}};
+    const std::vector<std::vector<double>> approx = broyden_method_batch(function, initial, 100, 1e-10);
+
+    REQUIRE(approx.size() == initial.size());
+    for (int k = 0; k < 3; k++) {
+        const double root = std::sqrt(static_cast<double>(k + 2));
+        REQUIRE(std::abs(approx[k][0] - root) < 1e-8);
+        REQUIRE(std::abs(approx[k][1] - (1.0 - root)) < 1e-8);
+    }
+}
@@ -0,0 +1,69 @@
+import math
+
+import numeric
+import pytest
+
+
+def example_system(x):
+    return [
+        3 * x[0] - math.cos(x[1] * x[2]) - 0.5,
+        x[0] ** 2 - 81 * (x[1] + 0.1) ** 2 + math.sin(x[2]) + 1.06,
+        math.exp(-x[0] * x[1]) + 20 * x[2] + (10 * math.pi - 3) / 3,
+    ]
+
+
+@pytest.mark.parametrize(
+    "function_name",
+    [
+        "finite_difference_jacobian",
+        "broyden_method",
+        "broyden_method_batch",
+    ],
+)
+def test_binding_docstrings_include_numpy_sections(function_name):
+    doc = getattr(numeric.nonlinear_systems, function_name).__doc__
+    assert doc is not None
+    assert "Parameters" in doc
+    assert "Returns" in doc
+
+
+@pytest.mark.smoke
+def test_finite_difference_jacobian_01():
+    def function(x):
+        return [2 * x[0] + x[1], -x[0] + 3 * x[1]]
+
+    approx = numeric.nonlinear_systems.finite_difference_jacobian(
+        function, [1.0, 2.0]
+    )
+    reference = [2.0, 1.0, -1.0, 3.0]
+    assert all(abs(a - r) < 1e-10 for a, r in zip(approx, reference))
+
+
+@pytest.mark.smoke
+def test_broyden_method_01():
+    approx = numeric.nonlinear_systems.broyden_method(
+        example_system, [0.1, 0.1, -0.1], tol=1e-10
+    )
+    reference = [0.5, 0.0, -math.pi / 6]
+    assert all(abs(a - r) < 1e-8 for a, r in zip(approx, reference))
+
+
+def test_broyden_method_02_error_singular_jacobian():
+    def function(x):
+        return [x[0] + x[1], 2 * x[0] + 2 * x[1]]
+
+    with pytest.raises(RuntimeError, match="singular Jacobian"):
+        numeric.nonlinear_systems.broyden_method(function, [1.0, 1.0])
+
+
+def test_broyden_method_batch_01():
+    def function(k, x):
+        return [x[0] ** 2 - (k + 2), x[0] + x[1] - 1]
+
+    approx = numeric.nonlinear_systems.broyden_method_batch(
+        function, [[1.0, 0.0], [2.0, 0.0], [2.0, 0.0]], tol=1e-10
+    )
+    for k, solution in enumerate(approx):
+        root = math.sqrt(k + 2)
+        assert abs(solution[0] - root) < 1e-8
+        assert abs(solution[1] - (1 - root)) < 1e-8
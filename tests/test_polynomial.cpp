@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/lane_batch.hpp"
+#include "numeric/polynomial.hpp"
+#include "numeric/root_approximation.hpp"
+
+TEST_CASE("Polynomial evaluation matches horners", "[polynomial]") {
+    const double coefs[] = {2.0, 0.0, -3.0, 3.0, -4.0};
+    const Polynomial<double, 4> p{{2.0, 0.0, -3.0, 3.0, -4.0}};
+    for (double x = -3.0; x <= 3.0; x += 0.25) {
+        const auto [value, derivative] = horners(4, coefs, x);
+        const auto [p_value, p_derivative] = p.evaluate_derivative(x);
+        REQUIRE(p(x) == value);
+        REQUIRE(p_value == value);
+        REQUIRE(p_derivative == derivative);
+    }
+
+    // P(x) = 2x^4 - 3x^2 + 3x - 4 at x = -2, Example 2 of Section 2.6.
+    const std::array<double, 4> all = p.evaluate_derivatives<3>(-2.0);
+    REQUIRE(all[0] == 10.0);
+    REQUIRE(all[1] == -49.0);
+    REQUIRE(all[2] == 90.0);
+    REQUIRE(all[3] == -96.0);
+    REQUIRE(p.derivative().derivative()(-2.0) == 90.0);
+    REQUIRE(Polynomial<double, 0>{{5.0}}.derivative()(1.0) == 0.0);
+}
+
+TEST_CASE("Polynomial deflation divides out a root", "[polynomial]") {
+    // (x - 1)(x - 2)(x + 3) = x^3 - 7x + 6.
+    const Polynomial<double, 3> p{{1.0, 0.0, -7.0, 6.0}};
+    const auto [quotient, remainder] = p.deflate(2.0);
+    REQUIRE(remainder == 0.0);
+    REQUIRE(quotient.coefs == std::array<double, 3>{1.0, 2.0, -3.0});
+    const auto [linear, rest] = quotient.deflate(1.0);
+    REQUIRE(rest == 0.0);
+    REQUIRE(linear.roots() == std::vector<double>{-3.0});
+    REQUIRE(std::get<1>(p.deflate(0.0)) == 6.0);
+}
+
+TEST_CASE("Polynomial closed-form roots of degrees two to four", "[polynomial]") {
+    const auto near = [](const std::vector<double>& roots, const std::vector<double>& expected) {
+        REQUIRE(roots.size() == expected.size());
+        for (std::size_t ii = 0; ii < roots.size(); ii++) {
+            REQUIRE(std::abs(roots[ii] - expected[ii]) < 1e-12 * std::max(1.0, std::abs(expected[ii])));
+        }
+    };
+
+    // Cancellation-prone quadratic x^2 - 1e8 x + 1.
+    near(Polynomial<double, 2>{{1.0, -1e8, 1.0}}.roots(), {1e-8, 1e8});
+    REQUIRE(Polynomial<double, 2>{{1.0, 0.0, 1.0}}.roots().empty());
+
+    near(Polynomial<double, 3>{{1.0, 0.0, -7.0, 6.0}}.roots(), {-3.0, 1.0, 2.0});
+    near(Polynomial<double, 3>{{2.0, -4.0, 2.0, -4.0}}.roots(), {2.0});
+    const std::vector<double> repeated = Polynomial<double, 3>{{1.0, -4.0, 5.0, -2.0}}.roots();
+    REQUIRE(std::abs(repeated.back() - 2.0) < 1e-12);
+    REQUIRE(std::abs(repeated.front() - 1.0) < 1e-6);
+
+    // (x + 2)(x - 1)(x - 3)(x - 4) and the biquadratic (x^2 - 1)(x^2 - 4).
+    near(Polynomial<double, 4>{{1.0, -6.0, 3.0, 26.0, -24.0}}.roots(), {-2.0, 1.0, 3.0, 4.0});
+    near(Polynomial<double, 4>{{1.0, 0.0, -5.0, 0.0, 4.0}}.roots(), {-2.0, -1.0, 1.0, 2.0});
+    // (x^2 + 1)(x - 1)(x - 5) has two real roots.
+    near(Polynomial<double, 4>{{1.0, -6.0, 6.0, -6.0, 5.0}}.roots(), {1.0, 5.0});
+    REQUIRE_THROWS_AS((Polynomial<double, 2>{{0.0, 1.0, 1.0}}.roots()), std::invalid_argument);
+}
+
+TEST_CASE("Polynomial works with the expression-template solvers", "[polynomial]") {
+    // x^3 + 4x^2 - 10, Example 1 of Section 2.1.
+    const Polynomial<double, 3> p{{1.0, 4.0, 0.0, -10.0}};
+    const double root = 1.36523001341410;
+    REQUIRE(std::abs(newton_method(p, 1.5, 100, 1e-12) - root) < 1e-10);
+    REQUIRE(std::abs(halley_method(p, 1.5, 100, 1e-12) - root) < 1e-10);
+    const LaneBatchResult result = newton_method_lanes(p, {1.0, 1.5, 2.0}, 2, 100, 1e-12);
+    for (double x : result.roots) {
+        REQUIRE(std::abs(x - root) < 1e-10);
+    }
+    REQUIRE(std::abs(p.roots()[0] - root) < 1e-12);
+}
@@ -1,6 +1,7 @@
 #include <cmath>
 #include <functional>
 #include <stdexcept>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -64,6 +65,80 @@ TEST_CASE("newton method approximates sqrt2", "[newton_method]") {
     REQUIRE(std::abs(approx - reference) < 1e-8);
 }
 
+TEST_CASE("taylor variable propagates first and second derivatives", "[taylor]") {
+    const Taylor<2> x = Taylor<2>::variable(0.5);
+    const Taylor<2> f = exp(sin(x)) / (1.0 + x * x);
+
+    const double s = std::sin(0.5);
+    const double c = std::cos(0.5);
+    const double g = std::exp(s);
+    const double d = 1.25;
+    const double fdx = g * c / d - g * 2.0 * 0.5 / (d * d);
+    REQUIRE(std::abs(f.value() - g / d) < 1e-14);
+    REQUIRE(std::abs(f.derivative(1) - fdx) < 1e-14);
+
+    const Taylor<2> h = sqrt(pow(x, 3) + log(x + 2.0));
+    const double u = 0.125 + std::log(2.5);
+    const double du = 0.75 + 1.0 / 2.5;
+    const double d2u = 3.0 - 1.0 / 6.25;
+    const double d2h = d2u / (2.0 * std::sqrt(u)) - du * du / (4.0 * std::pow(u, 1.5));
+    REQUIRE(std::abs(h.derivative(2) - d2h) < 1e-13);
+}
+
+TEST_CASE("halley method approximates cubic root", "[halley_method]") {
+    const std::function<Taylor<2>(const Taylor<2>&)> function = [](const Taylor<2>& x) {
+        return x * x * x + 4.0 * x * x - 10.0;
+    };
+    const double approx = halley_method(function, 1.5, 100, 1e-8);
+    const double reference = 1.36523001341410;
+
+    REQUIRE(std::abs(approx - reference) < 1e-8);
+}
+
+TEST_CASE("halley method needs fewer iterations than newton method", "[halley_method]") {
+    const std::function<Taylor<2>(const Taylor<2>&)> taylor_function = [](const Taylor<2>& x) {
+        return exp(x) - 2.0 * cos(x) - 3.0;
+    };
+    const std::function<double(double)> function = [](double x) {
+        return std::exp(x) - 2.0 * std::cos(x) - 3.0;
+    };
+    const std::function<double(double)> dfunction = [](double x) {
+        return std::exp(x) + 2.0 * std::sin(x);
+    };
+    SolveOptions options;
+    options.tol = 1e-12;
+
+    // Both methods get the exact derivative, so the iteration counts reflect
+    // cubic against quadratic convergence.
+    const SolveResult halley = halley_method(taylor_function, 3.0, options);
+    const SolveResult newton = newton_method(function, dfunction, 3.0, options);
+
+    REQUIRE(halley.status == SolveStatus::CONVERGED);
+    REQUIRE(newton.status == SolveStatus::CONVERGED);
+    REQUIRE(std::abs(halley.root - newton.root) < 1e-10);
+    REQUIRE(halley.iterations < newton.iterations);
+}
+
+TEST_CASE("householder method of order 3 approximates sqrt2", "[householder_method]") {
+    const std::function<Taylor<3>(const Taylor<3>&)> function = [](const Taylor<3>& x) {
+        return x * x - 2.0;
+    };
+    const double approx = householder_method<3>(function, 1.0, 100, 1e-12);
+    const double reference = 1.41421356237310;
+
+    REQUIRE(std::abs(approx - reference) < 1e-12);
+}
+
+TEST_CASE("householder method of order 1 matches newton iteration", "[householder_method]") {
+    const std::function<Taylor<1>(const Taylor<1>&)> function = [](const Taylor<1>& x) {
+        return cos(x) - x;
+    };
+    const double approx = householder_method<1>(function, 0.5, 100, 1e-12);
+    const double reference = 0.73908513321516064166;
+
+    REQUIRE(std::abs(approx - reference) < 1e-12);
+}
+
 TEST_CASE("secant method approximates root of cos(x) - x", "[secant_method]") {
     const std::function<double(double)> function = [](double x) {
         return std::cos(x) - x;
@@ -148,6 +223,28 @@ TEST_CASE("horners evaluates polynomial and derivative case 2", "[horners]") {
     REQUIRE(std::abs(derivative_value - 20.0) < 1e-12);
 }
 
+TEST_CASE("horners_batch matches horners across block boundaries", "[horners]") {
+    const double coefs[] = {2.0, 0.0, -3.0, 3.0, -4.0};
+    std::vector<double> x, values, derivatives;
+    for (int ii = 0; ii < 600; ii++) {
+        x.push_back(-3.0 + 0.01 * ii);
+    }
+    values.assign(x.size(), 0.0);
+    derivatives.assign(x.size(), 0.0);
+    horners_batch(4, coefs, x.data(), values.data(), derivatives.data(), static_cast<long long>(x.size()));
+    for (std::size_t ii = 0; ii < x.size(); ii++) {
+        const auto [poly_value, derivative_value] = horners(4, coefs, x[ii]);
+        REQUIRE(values[ii] == poly_value);
+        REQUIRE(derivatives[ii] == derivative_value);
+    }
+
+    // Results may overwrite the points, and constants have zero derivative.
+    horners_batch(0, coefs, x.data(), x.data(), derivatives.data(), 3);
+    REQUIRE(x[2] == 2.0);
+    REQUIRE(derivatives[2] == 0.0);
+    REQUIRE_THROWS_AS(horners_batch(4, coefs, x.data(), values.data(), derivatives.data(), -1), std::invalid_argument);
+}
+
 TEST_CASE("horners throws for negative degree", "[horners]") {
     const double coefs[] = {1.0};
     REQUIRE_THROWS_AS(horners(-1, coefs, 0.0), std::invalid_argument);
@@ -170,3 +267,80 @@ TEST_CASE("mullers throws for duplicate initial points", "[mullers]") {
 
     REQUIRE_THROWS_AS(mullers(function, 1.0, 1.0, 2.0, 100, 1e-8), std::invalid_argument);
 }
+
+TEST_CASE("interval newton encloses every root of cubic", "[interval_newton]") {
+    const std::function<Interval(const Interval&)> function = [](const Interval& x) {
+        return (x - 1.0) * (x + 2.0) * (x - 3.5);
+    };
+    const std::function<Interval(const Interval&)> derivative = [](const Interval& x) {
+        return 3.0 * pow(x, 2) - 5.0 * x - 5.5;
+    };
+    const std::vector<RootEnclosure> roots = interval_newton(function, derivative, -10.0, 10.0, 100, 1e-10, 4);
+    const double reference[] = {-2.0, 1.0, 3.5};
+
+    REQUIRE(roots.size() == 3);
+    for (int ii = 0; ii < 3; ii++) {
+        REQUIRE(roots[ii].unique);
+        REQUIRE(roots[ii].enclosure.contains(reference[ii]));
+        REQUIRE(roots[ii].enclosure.width() < 1e-10);
+    }
+}
+
+TEST_CASE("interval newton finds all roots of oscillating function", "[interval_newton]") {
+    const std::function<Interval(const Interval&)> function = [](const Interval& x) {
+        return sin(x) - 0.1 * x;
+    };
+    const std::function<Interval(const Interval&)> derivative = [](const Interval& x) {
+        return cos(x) - 0.1;
+    };
+    const std::vector<RootEnclosure> serial = interval_newton(function, derivative, -12.0, 12.0, 200, 1e-9, 1);
+    const std::vector<RootEnclosure> parallel = interval_newton(function, derivative, -12.0, 12.0, 200, 1e-9, 4);
+
+    REQUIRE(serial.size() == 7);
+    REQUIRE(parallel.size() == serial.size());
+    for (std::size_t ii = 0; ii < serial.size(); ii++) {
+        const double m = serial[ii].enclosure.midpoint();
+        REQUIRE(serial[ii].unique);
+        REQUIRE(std::abs(std::sin(m) - 0.1 * m) < 1e-8);
+        REQUIRE(parallel[ii].enclosure.contains(m));
+    }
+}
+
+TEST_CASE("interval newton returns nothing for root-free domain", "[interval_newton]") {
+    const std::function<Interval(const Interval&)> function = [](const Interval& x) {
+        return pow(x, 2) + 1.0;
+    };
+    const std::function<Interval(const Interval&)> derivative = [](const Interval& x) {
+        return 2.0 * x;
+    };
+
+    REQUIRE(interval_newton(function, derivative, -5.0, 5.0, 100, 1e-10, 2).empty());
+}
+
+TEST_CASE("chebyshev roots finds every root of oscillating function", "[chebyshev_roots]") {
+    int evaluations = 0;
+    const std::function<double(double)> function = [&evaluations](double x) {
+        evaluations += 1;
+        return std::cos(20.0 * x);
+    };
+    const std::vector<double> roots = chebyshev_roots(function, -1.0, 1.0, 128, 1e-14);
+
+    REQUIRE(roots.size() == 12);
+    for (int ii = 0; ii < 12; ii++) {
+        const double reference = (0.5 * M_PI + (ii - 6) * M_PI) / 20.0;
+        REQUIRE(std::abs(roots[ii] - reference) < 1e-12);
+    }
+    REQUIRE(evaluations <= 129);
+}
+
+TEST_CASE("chebyshev roots subdivides when degree is exceeded", "[chebyshev_roots]") {
+    const std::function<double(double)> function = [](double x) {
+        return std::sin(50.0 * x) + 0.5;
+    };
+    const std::vector<double> roots = chebyshev_roots(function, 0.0, 1.0, 32, 1e-13);
+
+    REQUIRE(roots.size() == 16);
+    for (double root : roots) {
+        REQUIRE(std::abs(function(root)) < 1e-10);
+    }
+}
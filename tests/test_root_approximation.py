@@ -1,3 +1,4 @@
+import array
 import math
 
 import numeric
@@ -11,9 +12,20 @@ import pytest
         "fixed_point",
         "first_derivative",
         "newton_method",
+        "halley_method",
+        "householder_method",
         "secant_method",
+        "false_position",
+        "steffensen_method",
         "mullers",
         "horners",
+        "horners_batch",
+        "interval_newton",
+        "chebyshev_roots",
+        "newton_method_batch",
+        "solve_stream",
+        "newton_method_lanes",
+        "secant_method_lanes",
     ],
 )
 def test_binding_docstrings_include_numpy_sections(function_name):
@@ -23,6 +35,27 @@ def test_binding_docstrings_include_numpy_sections(function_name):
     assert "Returns" in doc
 
 
+@pytest.mark.parametrize(
+    "function_name",
+    [
+        "bisection",
+        "fixed_point",
+        "newton_method",
+        "halley_method",
+        "householder_method",
+        "secant_method",
+        "false_position",
+        "steffensen_method",
+        "mullers",
+        "newton_method_batch",
+    ],
+)
+def test_options_docstrings_describe_options(function_name):
+    doc = getattr(numeric.root_approximation, function_name).__doc__
+    assert "options : SolveOptions" in doc
+    assert "SolveResult" in doc
+
+
 @pytest.mark.smoke
 def test_bisection_01():
     def function(x):
@@ -81,6 +114,53 @@ def test_newton_method_01():
     assert abs(approx - reference) < 1e-8
 
 
+@pytest.mark.smoke
+def test_taylor_01():
+    x = numeric.root_approximation.Taylor2.variable(2.0)
+    f = 3 * x**3 - x / 2 + 1
+
+    assert abs(f.value() - 24.0) < 1e-12
+    assert abs(f.derivative(1) - 35.5) < 1e-12
+    assert abs(f.derivative(2) - 36.0) < 1e-12
+
+
+def test_taylor_02_elementary_functions():
+    x = numeric.root_approximation.Taylor1.variable(0.5)
+    f = x.sin().exp()
+
+    assert abs(f.value() - math.exp(math.sin(0.5))) < 1e-14
+    reference = math.exp(math.sin(0.5)) * math.cos(0.5)
+    assert abs(f.derivative(1) - reference) < 1e-14
+
+
+@pytest.mark.smoke
+def test_halley_method_01():
+    def function(x):
+        return x**3 + 4 * x**2 - 10
+
+    approx = numeric.root_approximation.halley_method(function, 1.5)
+    reference = 1.36523001341410
+    assert abs(approx - reference) < 1e-8
+
+
+@pytest.mark.smoke
+def test_householder_method_01():
+    def function(x):
+        return x**2 - 2
+
+    approx = numeric.root_approximation.householder_method(function, 1.0)
+    reference = 1.41421356237310
+    assert abs(approx - reference) < 1e-8
+
+
+def test_householder_method_02_error_order():
+    def function(x):
+        return x**2 - 2
+
+    with pytest.raises(ValueError, match="orders 1 through 4"):
+        numeric.root_approximation.householder_method(function, 1.0, order=5)
+
+
 @pytest.mark.smoke
 def test_secant_method_01():
     def function(x):
@@ -168,6 +248,38 @@ def test_horners_03_error_empty_coefficients():
         numeric.root_approximation.horners([], 1.0)
 
 
+@pytest.mark.smoke
+def test_horners_batch_01():
+    np = pytest.importorskip("numpy")
+    coefs = np.array([2.0, 0.0, -3.0, 3.0, -4.0])
+    x = np.linspace(-3.0, 3.0, 601)
+    values = np.empty_like(x)
+    derivatives = np.empty_like(x)
+    numeric.root_approximation.horners_batch(coefs, x, values, derivatives)
+
+    assert np.allclose(values, np.polyval(coefs, x), atol=1e-10)
+    assert np.allclose(
+        derivatives, np.polyval(np.polyder(coefs), x), atol=1e-10
+    )
+
+
+def test_horners_batch_02_errors():
+    np = pytest.importorskip("numpy")
+    horners_batch = numeric.root_approximation.horners_batch
+    x = np.linspace(0.0, 1.0, 10)
+    out = np.empty(10)
+    with pytest.raises(ValueError, match="float64"):
+        horners_batch(np.ones(2), x.astype(np.float32), out, out)
+    with pytest.raises(ValueError, match="contiguous"):
+        horners_batch(np.ones(2), np.linspace(0.0, 1.0, 20)[::2], out, out)
+    readonly = np.empty(10)
+    readonly.flags.writeable = False
+    with pytest.raises(ValueError, match="writeable"):
+        horners_batch(np.ones(2), x, readonly, out)
+    with pytest.raises(ValueError, match="one entry per point"):
+        horners_batch(np.ones(2), x, np.empty(9), out)
+
+
 @pytest.mark.smoke
 def test_mullers_01():
     def function(x):
@@ -184,3 +296,232 @@ def test_mullers_02_error_duplicate_initial_points():
 
     with pytest.raises(ValueError, match="distinct initial approximations"):
         numeric.root_approximation.mullers(function, 1.0, 1.0, 2.0)
+
+
+@pytest.mark.smoke
+def test_interval_01():
+    Interval = numeric.root_approximation.Interval
+    x = Interval(1.0, 2.0)
+    y = 3 * x**2 - x / 10
+
+    assert y.contains(3 - 0.1)
+    assert y.contains(12 - 0.2)
+    assert y.lower <= 2.8
+    assert y.upper >= 11.9
+
+
+@pytest.mark.smoke
+def test_interval_newton_01():
+    def function(x):
+        return (x - 1) * (x + 2) * (x - 3.5)
+
+    def derivative(x):
+        return 3 * x**2 - 5 * x - 5.5
+
+    roots = numeric.root_approximation.interval_newton(
+        function, derivative, -10, 10
+    )
+    reference = [-2.0, 1.0, 3.5]
+    assert len(roots) == len(reference)
+    for root, value in zip(roots, reference):
+        assert root.unique
+        assert root.enclosure.contains(value)
+
+
+def test_interval_newton_02_no_roots():
+    def function(x):
+        return x**2 + 1
+
+    def derivative(x):
+        return 2 * x
+
+    roots = numeric.root_approximation.interval_newton(
+        function, derivative, -5, 5, num_threads=2
+    )
+    assert roots == []
+
+
+@pytest.mark.smoke
+def test_chebyshev_roots_01():
+    def function(x):
+        return math.cos(20 * x)
+
+    roots = numeric.root_approximation.chebyshev_roots(function, -1, 1)
+    reference = [(math.pi / 2 + k * math.pi) / 20 for k in range(-6, 6)]
+    assert len(roots) == len(reference)
+    assert all(abs(r - v) < 1e-12 for r, v in zip(roots, reference))
+
+
+def test_chebyshev_roots_02_cubic():
+    def function(x):
+        return x**3 + 4 * x**2 - 10
+
+    roots = numeric.root_approximation.chebyshev_roots(function, 1, 2)
+    reference = 1.36523001341410
+    assert len(roots) == 1
+    assert abs(roots[0] - reference) < 1e-12
+
+
+@pytest.mark.smoke
+def test_inverse_table_01():
+    def function(x):
+        return x + 0.5 * math.sin(x)
+
+    table = numeric.root_approximation.InverseTable(function, 0, 10)
+    for x in [0.0, 1.25, 4.321, 9.9]:
+        assert abs(table.evaluate(function(x)) - x) < 1e-10
+    assert table.pieces >= 1
+
+
+def test_inverse_table_02_batch_and_polish():
+    table = numeric.root_approximation.InverseTable(
+        math.exp, 0, 2, degree=4, tol=1e-5
+    )
+    ys = [1.0, 2.0, 5.0]
+    xs = table.evaluate(ys, polish=True)
+    assert all(abs(x - math.log(y)) < 1e-9 for x, y in zip(xs, ys))
+    with pytest.raises(IndexError):
+        table.evaluate(100.0)
+
+
+@pytest.mark.smoke
+def test_solution_cache_01():
+    def function(p, x):
+        return x**2 - p[0]
+
+    cache = numeric.root_approximation.SolutionCache(1, cell_size=0.5)
+    first = cache.newton_method(function, [2.0], 1.0)
+    assert abs(first - math.sqrt(2)) < 1e-10
+    assert cache.newton_method(function, [2.0], 1.0) == first
+    second = cache.secant_method(function, [2.1], 0.0, 1.0)
+    assert abs(second - math.sqrt(2.1)) < 1e-10
+    assert (cache.hits, cache.warm_starts, cache.misses) == (1, 1, 1)
+    assert len(cache) == 2
+
+
+@pytest.mark.smoke
+def test_compiled_expression_01():
+    func = numeric.root_approximation.CompiledExpression("x**3 + 4*x**2 - 10")
+    assert abs(func(1.5) - 2.375) < 1e-14
+    value, derivative = func.derivative(1.5)
+    assert abs(derivative - 18.75) < 1e-14
+    root = numeric.root_approximation.newton_method(func, 1.5, 100, 1e-12)
+    assert abs(root - 1.36523001341410) < 1e-12
+
+
+def test_compiled_expression_02_strings_and_parameters():
+    root = numeric.root_approximation.secant_method(
+        "cos(x) - p0 * x", 0.0, 1.0, params=[1.0]
+    )
+    assert abs(math.cos(root) - root) < 1e-8
+    roots = numeric.root_approximation.newton_method_batch(
+        "x**2 - p0", [1.0] * 3, [[1.0], [4.0], [9.0]], tol=1e-12
+    )
+    assert all(abs(r - v) < 1e-12 for r, v in zip(roots, [1.0, 2.0, 3.0]))
+
+
+def test_compiled_expression_03_error_syntax():
+    with pytest.raises(ValueError):
+        numeric.root_approximation.CompiledExpression("x +")
+
+
+@pytest.mark.smoke
+def test_solve_options_01():
+    def function(x):
+        return x**3 + 4 * x**2 - 10
+
+    ra = numeric.root_approximation
+    options = ra.SolveOptions(tol=1e-10)
+    result = ra.newton_method(function, 1.0, options)
+    assert result.status == ra.SolveStatus.CONVERGED
+    assert abs(result.root - 1.36523001341410) < 1e-8
+    assert result.evaluations > 0
+
+
+def test_solve_options_02_budget_and_cancellation():
+    def function(x):
+        return x**3 + 4 * x**2 - 10
+
+    ra = numeric.root_approximation
+    options = ra.SolveOptions(tol=1e-14, max_evaluations=5)
+    result = ra.bisection(function, 1, 2, options)
+    assert result.status == ra.SolveStatus.BUDGET_EXHAUSTED
+    assert result.evaluations == 5
+    assert result.bracket_lower <= 1.36523001341410 <= result.bracket_upper
+
+    token = ra.CancellationToken()
+    token.cancel()
+    options = ra.SolveOptions(cancellation=token)
+    result = ra.secant_method(function, 1, 2, options)
+    assert result.status == ra.SolveStatus.CANCELLED
+
+
+def test_solve_options_03_compiled_and_cached():
+    ra = numeric.root_approximation
+    options = ra.SolveOptions(tol=1e-12)
+    func = ra.CompiledExpression("x**2 - p0")
+    result = ra.newton_method(func, 1.0, options, params=[2.0])
+    assert result.status == ra.SolveStatus.CONVERGED
+    assert result.evaluations == result.iterations
+    assert abs(result.root - math.sqrt(2.0)) < 1e-12
+
+    results = ra.newton_method_batch(func, [1.0] * 3, [[1.0], [4.0], [9.0]],
+                                     options)
+    assert [round(r.root, 12) for r in results] == [1.0, 2.0, 3.0]
+
+    def function(params, x):
+        return x**2 - params[0]
+
+    cache = ra.SolutionCache(1)
+    first = cache.newton_method(function, [2.0], 1.0, options)
+    second = cache.newton_method(function, [2.0], 1.0, options)
+    assert first.status == second.status == ra.SolveStatus.CONVERGED
+    assert second.root == first.root
+    assert second.evaluations == 0
+
+
+@pytest.mark.smoke
+def test_solve_stream_01(tmp_path):
+    ra = numeric.root_approximation
+    values = array.array("d")
+    for k in range(100):
+        values.extend([1.0, 1.0 + k])
+    input_path = tmp_path / "input.bin"
+    output_path = tmp_path / "output.bin"
+    input_path.write_bytes(values.tobytes())
+
+    func = ra.CompiledExpression("x^2 - p0")
+    stats = ra.solve_stream(
+        func, str(input_path), str(output_path), chunk_records=16
+    )
+    assert stats.records == 100
+    assert stats.converged == 100
+    assert stats.chunks == 7
+
+    data = output_path.read_bytes()
+    assert len(data) == 16 * 100
+    roots = array.array("d", data)[::2]
+    for k, root in enumerate(roots):
+        assert abs(root - math.sqrt(1.0 + k)) < 1e-8
+
+
+@pytest.mark.smoke
+def test_newton_method_lanes_01():
+    ra = numeric.root_approximation
+    func = ra.CompiledExpression("x^3 - p0")
+    params = [[1.0 + 10.0 * k] for k in range(200)]
+    result = ra.newton_method_lanes(
+        func, [1.0] * 200, params, lanes=16, tol=1e-12
+    )
+    assert result.utilization > 0.9
+    for k, root in enumerate(result.roots):
+        assert abs(root - params[k][0] ** (1 / 3)) < 1e-10
+    assert all(s == ra.SolveStatus.CONVERGED for s in result.status)
+
+
+def test_secant_method_lanes_02():
+    ra = numeric.root_approximation
+    func = ra.CompiledExpression("cos(x) - x")
+    result = ra.secant_method_lanes(func, [0.0, 1.0], [0.5, 1.5], lanes=1)
+    for root in result.roots:
+        assert abs(root - 0.739085133215161) < 1e-8
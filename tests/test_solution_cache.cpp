@@ -0,0 +1,118 @@
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/solution_cache.hpp"
+
+TEST_CASE("solution cache returns exact hits without evaluating", "[solution_cache]") {
+    std::atomic<int> evaluations{0};
+    const std::function<double(const std::vector<double>&, double)> function =
+        [&evaluations](const std::vector<double>& p, double x) {
+            evaluations += 1;
+            return x * x - p[0];
+        };
+    SolutionCache cache{1, 0.1, 16};
+
+    const double first = cache.newton_method(function, {2.0}, 1.0, 100, 1e-12);
+    REQUIRE(std::abs(first - std::sqrt(2.0)) < 1e-10);
+    REQUIRE(cache.misses() == 1);
+
+    const int before = evaluations;
+    const double second = cache.newton_method(function, {2.0}, 1.0, 100, 1e-12);
+    REQUIRE(evaluations == before);
+    REQUIRE(second == first);
+    REQUIRE(cache.hits() == 1);
+    REQUIRE(std::abs(cache.hit_rate() - 0.5) < 1e-15);
+}
+
+TEST_CASE("solution cache warm starts from the nearest root", "[solution_cache]") {
+    std::atomic<int> evaluations{0};
+    const std::function<double(const std::vector<double>&, double)> function =
+        [&evaluations](const std::vector<double>& p, double x) {
+            evaluations += 1;
+            return std::cos(x) - p[0] * x - p[1];
+        };
+    SolutionCache cache{2, 0.05, 64};
+
+    cache.secant_method(function, {1.0, 0.0}, 0.0, 1.0, 100, 1e-12);
+    const int cold = evaluations;
+    evaluations = 0;
+    const double root = cache.secant_method(function, {1.01, 0.001}, 0.0, 1.0, 100, 1e-12);
+
+    REQUIRE(std::abs(function({1.01, 0.001}, root)) < 1e-10);
+    REQUIRE(cache.warm_starts() == 1);
+    REQUIRE(evaluations - 1 < cold);
+
+    double nearest = 0.0;
+    bool exact = true;
+    REQUIRE(cache.nearest({1.02, 0.0}, nearest, exact));
+    REQUIRE_FALSE(exact);
+    REQUIRE_FALSE(cache.nearest({5.0, 5.0}, nearest, exact));
+}
+
+TEST_CASE("solution cache does not store non-converged roots", "[solution_cache]") {
+    // x^2 + p has no real root, so every solve runs to MAX_ITERS.
+    const std::function<double(const std::vector<double>&, double)> function =
+        [](const std::vector<double>& p, double x) { return x * x + p[0]; };
+    SolutionCache cache{1, 0.1, 16};
+
+    cache.newton_method(function, {1.0}, 0.5, 20, 1e-12);
+    cache.secant_method(function, {1.0}, 0.5, 1.5, 20, 1e-12);
+    REQUIRE(cache.size() == 0);
+    REQUIRE(cache.hits() == 0);
+    REQUIRE(cache.misses() == 2);
+}
+
+TEST_CASE("solution cache options overloads report cached roots as converged", "[solution_cache]") {
+    const std::function<double(const std::vector<double>&, double)> function =
+        [](const std::vector<double>& p, double x) { return x * x - p[0]; };
+    SolutionCache cache{1, 0.1, 16};
+    SolveOptions options;
+    options.tol = 1e-12;
+
+    const SolveResult first = cache.secant_method(function, {2.0}, 1.0, 2.0, options);
+    REQUIRE(first.status == SolveStatus::CONVERGED);
+    REQUIRE(first.evaluations > 0);
+
+    const SolveResult second = cache.newton_method(function, {2.0}, 1.0, options);
+    REQUIRE(second.status == SolveStatus::CONVERGED);
+    REQUIRE(second.root == first.root);
+    REQUIRE(second.evaluations == 0);
+    REQUIRE(cache.hits() == 1);
+
+    options.max_evaluations = 1;
+    const SolveResult limited = cache.newton_method(function, {3.0}, 1.0, options);
+    REQUIRE(limited.status == SolveStatus::BUDGET_EXHAUSTED);
+    REQUIRE(cache.size() == 1);
+}
+
+TEST_CASE("solution cache evicts the least recently used entry", "[solution_cache]") {
+    SolutionCache cache{1, 1.0, 2};
+    cache.insert({0.0}, 10.0);
+    cache.insert({5.0}, 20.0);
+
+    double root = 0.0;
+    bool exact = false;
+    REQUIRE(cache.nearest({0.0}, root, exact));
+    cache.insert({9.0}, 30.0);
+
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.nearest({0.0}, root, exact));
+    REQUIRE(root == 10.0);
+    REQUIRE_FALSE(cache.nearest({5.0}, root, exact));
+
+    cache.clear();
+    REQUIRE(cache.size() == 0);
+    REQUIRE(cache.hits() == 0);
+}
+
+TEST_CASE("solution cache rejects invalid input", "[solution_cache]") {
+    REQUIRE_THROWS_AS(SolutionCache(0, 1.0, 4), std::invalid_argument);
+    REQUIRE_THROWS_AS(SolutionCache(1, 0.0, 4), std::invalid_argument);
+    SolutionCache cache{2, 1.0, 4};
+    REQUIRE_THROWS_AS(cache.insert({1.0}, 0.0), std::invalid_argument);
+}
@@ -0,0 +1,161 @@
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <tuple>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/expression.hpp"
+#include "numeric/root_approximation.hpp"
+#include "numeric/solve_options.hpp"
+
+TEST_CASE("solve options report convergence and evaluation counts", "[solve_options]") {
+    const std::function<double(double)> function = [](double x) {
+        return x * x * x + 4 * x * x - 10;
+    };
+    SolveOptions options;
+    options.tol = 1e-12;
+
+    const SolveResult result = secant_method(function, 1.0, 2.0, options);
+    REQUIRE(result.status == SolveStatus::CONVERGED);
+    REQUIRE(std::abs(result.root - 1.36523001341410) < 1e-12);
+    REQUIRE(result.evaluations == result.iterations);
+    REQUIRE(result.residual < 1e-10);
+    REQUIRE(result.bracket_lower <= 1.36523001341410);
+    REQUIRE(result.bracket_upper >= 1.36523001341410);
+}
+
+TEST_CASE("solve options stop at the evaluation budget with the best estimate", "[solve_options]") {
+    const std::function<double(double)> function = [](double x) { return x - 0.3; };
+    SolveOptions options;
+    options.tol = 1e-15;
+    options.max_evaluations = 10;
+
+    const SolveResult result = bisection(function, 0.0, 1.0, options);
+    REQUIRE(result.status == SolveStatus::BUDGET_EXHAUSTED);
+    REQUIRE(result.evaluations == 10);
+    REQUIRE(std::abs(result.root - 0.3) == result.residual);
+    REQUIRE(result.bracket_lower <= 0.3);
+    REQUIRE(result.bracket_upper >= 0.3);
+    REQUIRE(result.bracket_upper - result.bracket_lower < 1.0 / 256);
+}
+
+TEST_CASE("solve options honour the deadline", "[solve_options]") {
+    const std::function<double(double)> slow = [](double x) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return std::cos(x) - x;
+    };
+    SolveOptions options;
+    options.max_iters = 1000000;
+    options.tol = 0.0;
+    options.set_timeout(0.02);
+
+    SolveOptions generous;
+    generous.set_timeout(60.0);
+    const SolveResult result = fixed_point([](double x) { return std::cos(x); }, 1.0, generous);
+    REQUIRE(result.status == SolveStatus::CONVERGED);
+
+    const auto start = std::chrono::steady_clock::now();
+    const SolveResult limited = newton_method(slow, 1.0, options);
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    REQUIRE(limited.status == SolveStatus::DEADLINE_EXCEEDED);
+    REQUIRE(elapsed < 1.0);
+    REQUIRE(std::abs(std::cos(limited.root) - limited.root) == limited.residual);
+}
+
+TEST_CASE("solve options can be cancelled from another thread", "[solve_options]") {
+    const std::function<double(double)> slow = [](double x) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return x * x + 1.0;
+    };
+    SolveOptions options;
+    options.max_iters = 1000000;
+    options.tol = 0.0;
+    options.cancellation = CancellationToken{};
+
+    std::thread canceller{[token = *options.cancellation] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        token.cancel();
+    }};
+    const SolveResult result = secant_method(slow, 1.0, 2.0, options);
+    canceller.join();
+
+    REQUIRE(result.status == SolveStatus::CANCELLED);
+    REQUIRE(result.evaluations > 0);
+    REQUIRE(std::isnan(result.bracket_lower));
+}
+
+TEST_CASE("solve options apply to Taylor-mode methods", "[solve_options]") {
+    const std::function<Taylor<3>(const Taylor<3>&)> function = [](const Taylor<3>& x) {
+        return pow(x, 3) + 4.0 * pow(x, 2) - 10.0;
+    };
+    SolveOptions options;
+    options.tol = 1e-12;
+    options.max_evaluations = 2;
+
+    const SolveResult result = householder_method<3>(function, 1.5, options);
+    REQUIRE(result.status == SolveStatus::BUDGET_EXHAUSTED);
+    REQUIRE(result.iterations == 3);
+
+    options.max_evaluations = 0;
+    const SolveResult converged = householder_method<3>(function, 1.5, options);
+    REQUIRE(converged.status == SolveStatus::CONVERGED);
+    REQUIRE(std::abs(converged.root - 1.36523001341410) < 1e-12);
+}
+
+TEST_CASE("solve options apply to expression templates", "[solve_options]") {
+    const expression::Variable x;
+    const auto f = pow(x, 3) + 4.0 * pow(x, 2) - 10.0;
+    SolveOptions options;
+    options.tol = 1e-12;
+
+    const SolveResult newton = newton_method(f, 1.5, options);
+    REQUIRE(newton.status == SolveStatus::CONVERGED);
+    REQUIRE(std::abs(newton.root - 1.36523001341410) < 1e-12);
+    REQUIRE(newton.evaluations == newton.iterations);
+
+    const SolveResult halley = halley_method(f, 1.5, options);
+    REQUIRE(halley.status == SolveStatus::CONVERGED);
+    REQUIRE(std::abs(halley.root - 1.36523001341410) < 1e-12);
+    REQUIRE(halley.iterations < newton.iterations);
+
+    options.max_evaluations = 1;
+    REQUIRE(newton_method(f, 1.5, options).status == SolveStatus::BUDGET_EXHAUSTED);
+}
+
+TEST_CASE("newton method counts one evaluation per combined f and f' call", "[solve_options]") {
+    int calls = 0;
+    const std::function<std::tuple<double, double>(double)> function = [&calls](double x) {
+        calls += 1;
+        return std::make_tuple(x * x * x + 4 * x * x - 10, 3 * x * x + 8 * x);
+    };
+    SolveOptions options;
+    options.tol = 1e-12;
+
+    const SolveResult result = newton_method(function, 1.5, options);
+    REQUIRE(result.status == SolveStatus::CONVERGED);
+    REQUIRE(std::abs(result.root - 1.36523001341410) < 1e-12);
+    REQUIRE(result.evaluations == calls);
+    REQUIRE(result.evaluations == result.iterations);
+    REQUIRE(std::abs(newton_method(function, 1.5, 100, 1e-12) - result.root) < 1e-15);
+}
+
+TEST_CASE("solve options with too few iterations return the initial estimate", "[solve_options]") {
+    const std::function<double(double)> function = [](double x) { return x * x - 2.0; };
+    SolveOptions options;
+    options.max_iters = 1;
+
+    const SolveResult muller = mullers(function, 0.5, 1.0, 1.5, options);
+    REQUIRE(muller.status == SolveStatus::MAX_ITERATIONS);
+    REQUIRE(muller.root == 1.5);
+    REQUIRE(std::isnan(muller.error));
+
+    const SolveResult secant = secant_method(function, 1.0, 2.0, options);
+    REQUIRE(secant.status == SolveStatus::MAX_ITERATIONS);
+    REQUIRE(secant.root == 2.0);
+
+    options.max_iters = 0;
+    REQUIRE(newton_method(function, 1.5, options).root == 1.5);
+    REQUIRE(steffensen_method(function, 1.5, options).root == 1.5);
+}
@@ -0,0 +1,61 @@
+import math
+import os
+import subprocess
+import time
+from pathlib import Path
+
+import numeric
+import pytest
+from numeric.solver_client import SolverClient
+
+
+def find_daemon():
+    candidates = [
+        os.environ.get("NUMERIC_SOLVERD", ""),
+        Path(numeric.__file__).parent / "numeric-solverd",
+    ]
+    for candidate in candidates:
+        if candidate and os.access(candidate, os.X_OK):
+            return str(candidate)
+    return None
+
+
+@pytest.fixture
+def socket_path(tmp_path):
+    daemon = find_daemon()
+    if daemon is None:
+        pytest.skip("numeric-solverd is not built")
+    path = tmp_path / "solverd.sock"
+    process = subprocess.Popen([daemon, str(path), "2"])
+    for _ in range(100):
+        if path.exists():
+            break
+        time.sleep(0.05)
+    yield str(path)
+    process.terminate()
+    process.wait(timeout=10)
+
+
+@pytest.mark.smoke
+def test_solver_client_01(socket_path):
+    with SolverClient(socket_path, slots=2, slot_bytes=1 << 16) as client:
+        ids = [
+            client.submit("x^2 - p0", [1.0] * 10, [[2.0 + k]] * 10)
+            for k in range(5)
+        ]
+        assert client.in_flight <= 2
+        for k, request_id in enumerate(ids):
+            records = client.wait(request_id)
+            assert len(records) == 10
+            assert abs(records["root"][0] - math.sqrt(2.0 + k)) < 1e-8
+            assert (records["status"] == 0).all()
+
+
+def test_solver_client_02_errors(socket_path):
+    with SolverClient(socket_path, slots=1, slot_bytes=1024) as client:
+        with pytest.raises(RuntimeError):
+            client.solve("x^2 -", [1.0])
+        with pytest.raises(ValueError):
+            client.solve("x - 1", [0.0] * 100)
+        records = client.solve("x - 3", [0.0], method="secant")
+        assert abs(records["root"][0] - 3.0) < 1e-12
@@ -0,0 +1,181 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/solver_service.hpp"
+
+namespace {
+
+/**
+ * @brief Server running on a background thread for the lifetime of a test.
+ */
+struct RunningServer {
+    std::string path;
+    SolverServer server;
+    std::thread thread;
+
+    /**
+     * @brief Start a server with two worker threads on a fresh socket path.
+     *
+     * @param name Test-specific part of the socket path.
+     */
+    explicit RunningServer(const std::string& name) : path("/tmp/numeric-test-" + std::to_string(getpid()) + "-" + name + ".sock"), server(path, 2), thread([this] { server.run(); }) {}
+
+    /**
+     * @brief Stop the server and join its thread.
+     */
+    ~RunningServer(){
+        server.stop();
+        thread.join();
+    }
+};
+
+/**
+ * @brief Connect to a server and send a hello carrying the given descriptor,
+ * bypassing SolverClient so the ring can be left unsealed.
+ *
+ * @param path Socket path of the server.
+ * @param descriptor Descriptor of the ring.
+ * @param hello Hello message.
+ * @return Connected socket.
+ */
+int connect_raw(const std::string& path, int descriptor, const ServiceHello& hello){
+    const int socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    REQUIRE(connect(socket_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+
+    iovec data{const_cast<ServiceHello*>(&hello), sizeof(hello)};
+    alignas(cmsghdr) unsigned char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message{};
+    message.msg_iov = &data;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(header), &descriptor, sizeof(int));
+    REQUIRE(sendmsg(socket_fd, &message, MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(hello)));
+    return socket_fd;
+}
+
+}  // namespace
+
+TEST_CASE("solver service pipelines more requests than slots", "[solver_service]") {
+    RunningServer running{"pipeline"};
+    SolverClient client{running.path, 2, 1 << 16};
+    SolveOptions options;
+    options.tol = 1e-12;
+
+    std::vector<std::uint64_t> ids;
+    for (int kk = 0; kk < 6; kk++) {
+        const std::vector<double> x0(100, 1.0);
+        std::vector<std::vector<double>> params;
+        for (int jj = 0; jj < 100; jj++) {
+            params.push_back({2.0 + kk * 100 + jj});
+        }
+        const StreamMethod method = kk % 2 == 0 ? StreamMethod::NEWTON : StreamMethod::SECANT;
+        ids.push_back(client.submit("x^2 - p0", x0, params, method, options));
+        REQUIRE(client.in_flight() <= 2);
+    }
+
+    for (int kk = 5; kk >= 0; kk--) {
+        const std::vector<StreamRecord> records = client.wait(ids[kk]);
+        REQUIRE(records.size() == 100);
+        for (int jj = 0; jj < 100; jj++) {
+            REQUIRE(std::abs(records[jj].root - std::sqrt(2.0 + kk * 100 + jj)) < 1e-9);
+            REQUIRE(records[jj].status == static_cast<int>(SolveStatus::CONVERGED));
+        }
+    }
+    REQUIRE(client.in_flight() == 0);
+    REQUIRE(running.server.records_solved() == 600);
+    REQUIRE_THROWS_AS(client.wait(ids[0]), std::invalid_argument);
+}
+
+TEST_CASE("solver service splits large requests into blocks", "[solver_service]") {
+    RunningServer running{"blocks"};
+    SolverClient client{running.path, 1, 1 << 16};
+    SolveOptions options;
+
+    std::vector<double> x0;
+    for (int kk = 0; kk < 1000; kk++) {
+        x0.push_back(0.1 * kk);
+    }
+    const std::vector<StreamRecord> records = client.solve("cos(x) - p0 * x", x0, {{0.5}}, StreamMethod::NEWTON, options);
+    REQUIRE(records.size() == 1000);
+    REQUIRE(std::abs(std::cos(records[0].root) - 0.5 * records[0].root) < 1e-8);
+}
+
+TEST_CASE("solver service reports request errors and stays usable", "[solver_service]") {
+    RunningServer running{"errors"};
+    SolverClient client{running.path, 4, 1024};
+    SolveOptions options;
+
+    REQUIRE_THROWS_AS(client.solve("x^2 -", {1.0}, {}, StreamMethod::NEWTON, options), std::runtime_error);
+    REQUIRE_THROWS_AS(client.solve("x^2 - p0", {1.0}, {}, StreamMethod::NEWTON, options), std::runtime_error);
+    REQUIRE_THROWS_AS(client.solve("x - 1", std::vector<double>(100, 0.0), {}, StreamMethod::NEWTON, options), std::invalid_argument);
+    REQUIRE_THROWS_AS(client.solve("x - p0", {1.0, 2.0}, {{1.0}, {1.0}, {1.0}}, StreamMethod::NEWTON, options), std::invalid_argument);
+
+    const std::vector<StreamRecord> records = client.solve("x - 3", {0.0}, {}, StreamMethod::SECANT, options);
+    REQUIRE(std::abs(records[0].root - 3.0) < 1e-12);
+    REQUIRE(client.solve("x - 3", {}, {}, StreamMethod::NEWTON, options).empty());
+}
+
+TEST_CASE("solver service survives pathologically nested sources", "[solver_service]") {
+    RunningServer running{"nesting"};
+    SolverClient client{running.path, 1, 1024};
+    SolveOptions options;
+
+    const std::string nested = std::string(32000, '(') + "x" + std::string(32000, ')');
+    REQUIRE_THROWS_AS(client.solve(nested, {1.0}, {}, StreamMethod::NEWTON, options), std::runtime_error);
+    REQUIRE_THROWS_AS(client.solve(std::string(60000, '-') + "x", {1.0}, {}, StreamMethod::NEWTON, options), std::runtime_error);
+
+    // A long flat chain is within the limits and compiles.
+    std::string chain = "x - 20000";
+    for (int kk = 1; kk < 10000; kk++) {
+        chain += " + x";
+    }
+    const std::vector<StreamRecord> records = client.solve(chain, {0.0}, {}, StreamMethod::NEWTON, options);
+    REQUIRE(std::abs(records[0].root - 2.0) < 1e-9);
+
+    SolverClient other{running.path, 1, 1024};
+    REQUIRE(std::abs(other.solve("x - 3", {0.0}, {}, StreamMethod::SECANT, options)[0].root - 3.0) < 1e-12);
+}
+
+TEST_CASE("solver service refuses rings that are not sealed against shrinking", "[solver_service]") {
+    RunningServer running{"unsealed"};
+    const ServiceHello hello{SERVICE_PROTOCOL_VERSION, 1, 1024};
+    const int descriptor = memfd_create("numeric-test", MFD_CLOEXEC);
+    REQUIRE(descriptor >= 0);
+    REQUIRE(ftruncate(descriptor, 1024) == 0);
+
+    // The server closes the connection instead of mapping the ring, which the
+    // client could otherwise truncate under a running solve.
+    const int socket_fd = connect_raw(running.path, descriptor, hello);
+    char byte = 0;
+    REQUIRE(read(socket_fd, &byte, 1) == 0);
+    close(socket_fd);
+    close(descriptor);
+
+    SolverClient client{running.path, 1, 1024};
+    SolveOptions options;
+    REQUIRE(std::abs(client.solve("x - 3", {0.0}, {}, StreamMethod::SECANT, options)[0].root - 3.0) < 1e-12);
+}
+
+TEST_CASE("solver client reports a missing server", "[solver_service]") {
+    REQUIRE_THROWS_AS(SolverClient("/tmp/numeric-test-missing.sock", 1, 1024), std::runtime_error);
+    REQUIRE_THROWS_AS(SolverClient("/tmp/numeric-test-missing.sock", 0, 1024), std::invalid_argument);
+}
@@ -0,0 +1,162 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/streaming.hpp"
+
+namespace {
+
+/**
+ * @brief Write doubles to a binary file.
+ *
+ * @param path File path.
+ * @param values Values to write.
+ */
+void write_doubles(const std::string& path, const std::vector<double>& values){
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+}
+
+/**
+ * @brief Read every output record of a binary file.
+ *
+ * @param path File path.
+ * @return Records in file order.
+ */
+std::vector<StreamRecord> read_records(const std::string& path){
+    std::ifstream in{path, std::ios::binary | std::ios::ate};
+    std::vector<StreamRecord> records(static_cast<std::size_t>(in.tellg()) / sizeof(StreamRecord));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(StreamRecord));
+    return records;
+}
+
+}  // namespace
+
+TEST_CASE("solve_stream solves every record across chunks", "[streaming]") {
+    const std::string input = "test_streaming_input.bin";
+    const std::string output = "test_streaming_output.bin";
+    const CompiledExpression function{"x^2 - p0"};
+
+    const int count = 1000;
+    std::vector<double> values;
+    for (int kk = 0; kk < count; kk++) {
+        values.push_back(1.0);
+        values.push_back(1.0 + kk);
+    }
+    write_doubles(input, values);
+
+    for (StreamMethod method : {StreamMethod::NEWTON, StreamMethod::SECANT}) {
+        SolveOptions options;
+        options.tol = 1e-12;
+        const StreamStatistics statistics = solve_stream(function, input, output, method, options, 64, 4);
+        REQUIRE(statistics.records == count);
+        REQUIRE(statistics.converged == count);
+        REQUIRE(statistics.chunks == 16);
+        REQUIRE(statistics.evaluations > count);
+
+        const std::vector<StreamRecord> records = read_records(output);
+        REQUIRE(records.size() == static_cast<std::size_t>(count));
+        for (int kk = 0; kk < count; kk++) {
+            REQUIRE(std::abs(records[kk].root - std::sqrt(1.0 + kk)) < 1e-9);
+            REQUIRE(records[kk].status == static_cast<int>(SolveStatus::CONVERGED));
+            REQUIRE(records[kk].iterations > 0);
+        }
+    }
+    std::remove(input.c_str());
+    std::remove(output.c_str());
+}
+
+TEST_CASE("solve_stream reports limits per record", "[streaming]") {
+    const std::string input = "test_streaming_limits.bin";
+    const std::string output = "test_streaming_limits_out.bin";
+    write_doubles(input, {1.0, 2.0, 3.0, 2.0});
+
+    SolveOptions options;
+    options.tol = 0.0;
+    options.max_evaluations = 3;
+    const StreamStatistics statistics = solve_stream(CompiledExpression{"x^2 - p0"}, input, output, StreamMethod::NEWTON, options, 1, 1);
+    REQUIRE(statistics.converged == 0);
+    REQUIRE(statistics.evaluations == 6);
+    for (const StreamRecord& record : read_records(output)) {
+        REQUIRE(record.status == static_cast<int>(SolveStatus::BUDGET_EXHAUSTED));
+        REQUIRE(std::abs(record.root - std::sqrt(2.0)) < 0.1);
+    }
+    std::remove(input.c_str());
+    std::remove(output.c_str());
+}
+
+TEST_CASE("solve_stream handles empty and malformed inputs", "[streaming]") {
+    const std::string input = "test_streaming_empty.bin";
+    const std::string output = "test_streaming_empty_out.bin";
+    const CompiledExpression function{"x - p0"};
+
+    write_doubles(input, {});
+    SolveOptions options;
+    const StreamStatistics statistics = solve_stream(function, input, output, StreamMethod::NEWTON, options, 16, 1);
+    REQUIRE(statistics.records == 0);
+    REQUIRE(read_records(output).empty());
+
+    write_doubles(input, {1.0, 2.0, 3.0});
+    REQUIRE_THROWS_AS(solve_stream(function, input, output, StreamMethod::NEWTON, options, 16, 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(solve_stream(function, input, output, StreamMethod::NEWTON, options, 0, 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(
+        solve_stream(function, "test_streaming_missing.bin", output, StreamMethod::NEWTON, options, 16, 1),
+        std::runtime_error
+    );
+    std::remove(input.c_str());
+    std::remove(output.c_str());
+}
+
+TEST_CASE("solve_stream stops promptly when cancelled partway", "[streaming]") {
+    const std::string input = "test_streaming_cancel.bin";
+    const std::string output = "test_streaming_cancel_out.bin";
+    const int count = 500000;
+    std::vector<double> values;
+    for (int kk = 0; kk < count; kk++) {
+        values.push_back(1.0);
+        values.push_back(1.0 + kk);
+    }
+    write_doubles(input, values);
+
+    SolveOptions options;
+    options.tol = 1e-12;
+    const CancellationToken token;
+    options.cancellation = token;
+    StreamStatistics statistics;
+    std::thread worker{[&]() {
+        statistics = solve_stream(CompiledExpression{"x^2 - p0"}, input, output, StreamMethod::NEWTON, options, 4096, 1);
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    token.cancel();
+    worker.join();
+
+    const std::vector<StreamRecord> records = read_records(output);
+    REQUIRE(statistics.converged > 0);
+    REQUIRE(statistics.converged < count);
+    long long cancelled = 0;
+    for (const StreamRecord& record : records) {
+        if (record.status == static_cast<int>(SolveStatus::CANCELLED)) {
+            cancelled += 1;
+        } else {
+            REQUIRE(record.status == static_cast<int>(SolveStatus::CONVERGED));
+        }
+    }
+    REQUIRE(statistics.converged + cancelled == count);
+    REQUIRE(records.back().root == 1.0);
+    REQUIRE(records.back().iterations == 0);
+
+    // A stream cancelled before it starts never enters the solver.
+    const StreamStatistics skipped = solve_stream(CompiledExpression{"x^2 - p0"}, input, output, StreamMethod::NEWTON, options, 4096, 1);
+    REQUIRE(skipped.evaluations == 0);
+    REQUIRE(skipped.converged == 0);
+    std::remove(input.c_str());
+    std::remove(output.c_str());
+}
@@ -0,0 +1,39 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "numeric/thread_pool.hpp"
+
+TEST_CASE("thread pool runs tasks submitted from tasks", "[thread_pool]") {
+    ThreadPool pool{4};
+    std::atomic<int> count{0};
+
+    for (int ii = 0; ii < 10; ii++) {
+        pool.submit([&pool, &count] {
+            count += 1;
+            pool.submit([&count] { count += 1; });
+        });
+    }
+    pool.wait();
+
+    REQUIRE(count == 20);
+}
+
+TEST_CASE("thread pool rethrows task exceptions from wait", "[thread_pool]") {
+    ThreadPool pool{2};
+    pool.submit([] { throw std::runtime_error("task failed"); });
+
+    REQUIRE_THROWS_AS(pool.wait(), std::runtime_error);
+}
+
+TEST_CASE("parallel for visits every index once", "[parallel_for]") {
+    ThreadPool pool{3};
+    std::vector<int> visits(1000, 0);
+    parallel_for(pool, 0, static_cast<int>(visits.size()), [&visits](int ii) { visits[ii] += 1; });
+
+    for (int value : visits) {
+        REQUIRE(value == 1);
+    }
+}